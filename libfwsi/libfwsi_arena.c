@@ -0,0 +1,527 @@
+/*
+ * Arena (memory region) functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_arena.h"
+#include "libfwsi_libcerror.h"
+
+/* The size of the block header, which is followed by the block data
+ */
+#define LIBFWSI_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libfwsi_arena_block_t ) + ( LIBFWSI_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWSI_ARENA_ALIGNMENT - 1 ) )
+
+/* The size of the arena when stored at the start of its first block
+ */
+#define LIBFWSI_ARENA_IN_BLOCK_SIZE \
+	( ( sizeof( libfwsi_arena_t ) + ( LIBFWSI_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWSI_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_initialize(
+     libfwsi_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( SSIZE_MAX - LIBFWSI_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libfwsi_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libfwsi_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates an arena that is stored at the start of its first block
+ * The arena and the first block, with block size bytes available for allocations,
+ * are allocated as a single block of memory
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_initialize_in_first_block(
+     libfwsi_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	static char *function              = "libfwsi_arena_initialize_in_first_block";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( SSIZE_MAX - LIBFWSI_ARENA_BLOCK_HEADER_SIZE - LIBFWSI_ARENA_IN_BLOCK_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block = (libfwsi_arena_block_t *) memory_allocate(
+	                                         LIBFWSI_ARENA_BLOCK_HEADER_SIZE + LIBFWSI_ARENA_IN_BLOCK_SIZE + block_size );
+
+	if( arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena block.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block->next_block = NULL;
+	arena_block->size       = LIBFWSI_ARENA_IN_BLOCK_SIZE + block_size;
+	arena_block->offset     = LIBFWSI_ARENA_IN_BLOCK_SIZE;
+
+	*arena = (libfwsi_arena_t *) &( ( (uint8_t *) arena_block )[ LIBFWSI_ARENA_BLOCK_HEADER_SIZE ] );
+
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libfwsi_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 arena_block );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+	( *arena )->first_block       = arena_block;
+	( *arena )->current_block     = arena_block;
+	( *arena )->last_block        = arena_block;
+	( *arena )->block_size        = block_size;
+	( *arena )->is_in_first_block = 1;
+
+	return( 1 );
+}
+
+/* Frees an arena
+ * This releases all the memory allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_free(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	libfwsi_arena_block_t *next_block  = NULL;
+	static char *function              = "libfwsi_arena_free";
+	uint8_t is_in_first_block          = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		is_in_first_block = ( *arena )->is_in_first_block;
+		arena_block       = ( *arena )->first_block;
+
+		/* An arena stored in its first block is released with that block
+		 */
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		if( is_in_first_block == 0 )
+		{
+			memory_free(
+			 *arena );
+		}
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears an arena
+ * This releases all the memory allocated from the arena for reuse
+ * but retains the blocks of the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_clear(
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	static char *function              = "libfwsi_arena_clear";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block = arena->first_block;
+
+	while( arena_block != NULL )
+	{
+		arena_block->offset = 0;
+
+		arena_block = arena_block->next_block;
+	}
+	/* An arena stored in its first block retains the start of that block
+	 */
+	if( arena->is_in_first_block != 0 )
+	{
+		arena->first_block->offset = LIBFWSI_ARENA_IN_BLOCK_SIZE;
+	}
+	arena->current_block = arena->first_block;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * If the arena is not set the memory is allocated on the heap
+ * Memory allocated from an arena is released when the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_allocate(
+     libfwsi_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_block_t *arena_block = NULL;
+	static char *function              = "libfwsi_arena_allocate";
+	size_t aligned_size                = 0;
+	size_t block_size                  = 0;
+
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) ( SSIZE_MAX - LIBFWSI_ARENA_BLOCK_HEADER_SIZE - LIBFWSI_ARENA_ALIGNMENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		*memory = memory_allocate(
+		           size );
+
+		if( *memory == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate memory.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	aligned_size = ( size + ( LIBFWSI_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWSI_ARENA_ALIGNMENT - 1 );
+
+	/* The blocks after the current block are unused after the arena was cleared
+	 */
+	arena_block = arena->current_block;
+
+	while( ( arena_block != NULL )
+	    && ( aligned_size > ( arena_block->size - arena_block->offset ) ) )
+	{
+		arena_block = arena_block->next_block;
+	}
+	if( arena_block == NULL )
+	{
+		block_size = arena->block_size;
+
+		if( aligned_size > block_size )
+		{
+			block_size = aligned_size;
+		}
+		arena_block = (libfwsi_arena_block_t *) memory_allocate(
+		                                         LIBFWSI_ARENA_BLOCK_HEADER_SIZE + block_size );
+
+		if( arena_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block.",
+			 function );
+
+			return( -1 );
+		}
+		arena_block->next_block = NULL;
+		arena_block->size       = block_size;
+		arena_block->offset     = 0;
+
+		if( arena->last_block == NULL )
+		{
+			arena->first_block = arena_block;
+		}
+		else
+		{
+			arena->last_block->next_block = arena_block;
+		}
+		arena->last_block = arena_block;
+	}
+	arena->current_block = arena_block;
+
+	*memory = &( ( (uint8_t *) arena_block )[ LIBFWSI_ARENA_BLOCK_HEADER_SIZE + arena_block->offset ] );
+
+	arena_block->offset += aligned_size;
+
+	return( 1 );
+}
+
+/* Creates a value
+ * If the arena is set the value is allocated from the arena and cleared,
+ * otherwise the value is created using the initialize value function
+ * Make sure the value value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_arena_initialize_value(
+     libfwsi_arena_t *arena,
+     intptr_t **value,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_arena_initialize_value";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialize_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( initialize_value(
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create value.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfwsi_arena_allocate(
+	     arena,
+	     value_size,
+	     (void **) value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *value,
+	     0,
+	     value_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value.",
+		 function );
+
+		*value = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
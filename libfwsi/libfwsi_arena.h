@@ -0,0 +1,118 @@
+/*
+ * Arena (memory region) functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ARENA_H )
+#define _LIBFWSI_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the memory allocated from an arena
+ */
+#define LIBFWSI_ARENA_ALIGNMENT			16
+
+typedef struct libfwsi_arena_block libfwsi_arena_block_t;
+
+struct libfwsi_arena_block
+{
+	/* The next block
+	 */
+	libfwsi_arena_block_t *next_block;
+
+	/* The size of the block data
+	 */
+	size_t size;
+
+	/* The offset of the unused part of the block data
+	 */
+	size_t offset;
+};
+
+typedef struct libfwsi_arena libfwsi_arena_t;
+
+struct libfwsi_arena
+{
+	/* The first block
+	 */
+	libfwsi_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libfwsi_arena_block_t *current_block;
+
+	/* The last block
+	 */
+	libfwsi_arena_block_t *last_block;
+
+	/* The (default) block size
+	 */
+	size_t block_size;
+
+	/* Value to indicate the arena is stored at the start of its first block
+	 */
+	uint8_t is_in_first_block;
+};
+
+int libfwsi_arena_initialize(
+     libfwsi_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libfwsi_arena_initialize_in_first_block(
+     libfwsi_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libfwsi_arena_free(
+     libfwsi_arena_t **arena,
+     libcerror_error_t **error );
+
+int libfwsi_arena_clear(
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwsi_arena_allocate(
+     libfwsi_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+int libfwsi_arena_initialize_value(
+     libfwsi_arena_t *arena,
+     intptr_t **value,
+     size_t value_size,
+     int (*initialize_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ARENA_H ) */
+
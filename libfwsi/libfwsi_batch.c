@@ -0,0 +1,1490 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_arena.h"
+#include "libfwsi_batch.h"
+#include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcdata.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_types.h"
+#include "libfwsi_unused.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "libfwsi_libcthreads.h"
+#endif
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_initialize(
+     libfwsi_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = memory_allocate_structure(
+	                  libfwsi_internal_batch_t );
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch,
+	     0,
+	     sizeof( libfwsi_internal_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		goto on_error;
+	}
+	internal_batch->number_of_threads                 = 1;
+	internal_batch->decode_item_types                 = LIBFWSI_DECODE_ITEM_TYPES_ALL;
+	internal_batch->decode_extension_block_signatures = LIBFWSI_DECODE_EXTENSION_BLOCK_SIGNATURES_ALL;
+
+	if( libcdata_array_initialize(
+	     &( internal_batch->item_lists_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item lists array.",
+		 function );
+
+		goto on_error;
+	}
+	*batch = (libfwsi_batch_t *) internal_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch != NULL )
+	{
+		memory_free(
+		 internal_batch );
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * Any item list retrieved from the batch is freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_free(
+     libfwsi_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_free";
+	int result                               = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		internal_batch = (libfwsi_internal_batch_t *) *batch;
+		*batch         = NULL;
+
+		if( libfwsi_internal_batch_free_item_lists(
+		     internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item lists.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_batch->item_lists_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the item lists array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_batch->tasks != NULL )
+		{
+			memory_free(
+			 internal_batch->tasks );
+		}
+		if( internal_batch->parse_error_offsets != NULL )
+		{
+			memory_free(
+			 internal_batch->parse_error_offsets );
+		}
+		if( internal_batch->parse_errors != NULL )
+		{
+			memory_free(
+			 internal_batch->parse_errors );
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( result );
+}
+
+/* Frees the item lists of a batch and the arenas of the tasks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_batch_free_item_lists(
+     libfwsi_internal_batch_t *internal_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_batch_free_item_lists";
+	int result            = 1;
+	int task_index        = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	/* The item lists are freed before the arenas their items are allocated from
+	 */
+	if( libcdata_array_empty(
+	     internal_batch->item_lists_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_list_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty item lists array.",
+		 function );
+
+		result = -1;
+	}
+	for( task_index = 0;
+	     task_index < internal_batch->number_of_allocated_tasks;
+	     task_index++ )
+	{
+		if( internal_batch->tasks[ task_index ].arena != NULL )
+		{
+			if( libfwsi_arena_free(
+			     &( internal_batch->tasks[ task_index ].arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena of task: %d.",
+				 function,
+				 task_index );
+
+				result = -1;
+			}
+		}
+	}
+	internal_batch->number_of_entries = 0;
+	internal_batch->number_of_tasks   = 0;
+
+	return( result );
+}
+
+/* Retrieves the parse flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_get_parse_flags(
+     libfwsi_batch_t *batch,
+     uint32_t *parse_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_parse_flags";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( parse_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse flags.",
+		 function );
+
+		return( -1 );
+	}
+	*parse_flags = internal_batch->parse_flags;
+
+	return( 1 );
+}
+
+/* Sets the parse flags
+ * The parse flags apply to all item lists of the batch, therefore the item lists
+ * of a previous batch are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_set_parse_flags(
+     libfwsi_batch_t *batch,
+     uint32_t parse_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_set_parse_flags";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( parse_flags & ~( LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_USE_ARENA | LIBFWSI_PARSE_FLAG_BORROW_DATA | LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags: 0x%08" PRIx32 ".",
+		 function,
+		 parse_flags );
+
+		return( -1 );
+	}
+	if( parse_flags != internal_batch->parse_flags )
+	{
+		if( libfwsi_internal_batch_free_item_lists(
+		     internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item lists.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->parse_flags = parse_flags;
+	}
+	return( 1 );
+}
+
+/* Retrieves the decode types
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_get_decode_types(
+     libfwsi_batch_t *batch,
+     uint32_t *item_types,
+     uint64_t *extension_block_signatures,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_decode_types";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( item_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item types.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_block_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block signatures.",
+		 function );
+
+		return( -1 );
+	}
+	*item_types                 = internal_batch->decode_item_types;
+	*extension_block_signatures = internal_batch->decode_extension_block_signatures;
+
+	return( 1 );
+}
+
+/* Sets the decode types
+ * The decode types apply to all item lists of the batch, therefore the item lists
+ * of a previous batch are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_set_decode_types(
+     libfwsi_batch_t *batch,
+     uint32_t item_types,
+     uint64_t extension_block_signatures,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_set_decode_types";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( item_types != internal_batch->decode_item_types )
+	 || ( extension_block_signatures != internal_batch->decode_extension_block_signatures ) )
+	{
+		if( libfwsi_internal_batch_free_item_lists(
+		     internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item lists.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->decode_item_types                 = item_types;
+		internal_batch->decode_extension_block_signatures = extension_block_signatures;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to copy a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_get_number_of_threads(
+     libfwsi_batch_t *batch,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_number_of_threads";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_batch->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to copy a batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_set_number_of_threads(
+     libfwsi_batch_t *batch,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_set_number_of_threads";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > ( INT_MAX / LIBFWSI_BATCH_TASKS_PER_THREAD ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Prepares a batch for a number of entries
+ * The item lists of the previous batch are cleared and reused, additional item lists are created when needed
+ * The entries are split into tasks of consecutive entries with a similar total size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_batch_prepare(
+     libfwsi_internal_batch_t *internal_batch,
+     const uint8_t * const *byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_entries,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_batch_task_t *task                       = NULL;
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_list_t *item_list                   = NULL;
+	static char *function                            = "libfwsi_internal_batch_prepare";
+	void *reallocation                               = NULL;
+	size_t entry_weight                              = 0;
+	size_t task_boundary                             = 0;
+	size_t task_size                                 = 0;
+	size_t total_weight                              = 0;
+	size_t weight                                    = 0;
+	int entry_index                                  = 0;
+	int first_entry_index                            = 0;
+	int item_list_index                              = 0;
+	int maximum_number_of_tasks                      = 0;
+	int number_of_item_lists                         = 0;
+	int task_index                                   = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_batch->number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->item_lists_array,
+		     entry_index,
+		     (intptr_t **) &item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item list: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwsi_item_list_clear(
+		     item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear item list: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	item_list = NULL;
+
+	internal_batch->number_of_entries = 0;
+	internal_batch->number_of_tasks   = 0;
+
+	/* The items of all item lists are released at once
+	 */
+	for( task_index = 0;
+	     task_index < internal_batch->number_of_allocated_tasks;
+	     task_index++ )
+	{
+		if( internal_batch->tasks[ task_index ].arena != NULL )
+		{
+			if( libfwsi_arena_clear(
+			     internal_batch->tasks[ task_index ].arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear arena of task: %d.",
+				 function,
+				 task_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( number_of_entries > internal_batch->number_of_allocated_entries )
+	{
+		reallocation = memory_reallocate(
+		                internal_batch->parse_errors,
+		                sizeof( int ) * number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize parse errors.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->parse_errors = (int *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_batch->parse_error_offsets,
+		                sizeof( size_t ) * number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize parse error offsets.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->parse_error_offsets         = (size_t *) reallocation;
+		internal_batch->number_of_allocated_entries = number_of_entries;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->item_lists_array,
+	     &number_of_item_lists,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of item lists.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_item_lists < number_of_entries )
+	{
+		if( libfwsi_item_list_initialize(
+		     &item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item list.",
+			 function );
+
+			goto on_error;
+		}
+		internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+		internal_item_list->parse_flags                       = internal_batch->parse_flags;
+		internal_item_list->decode_item_types                 = internal_batch->decode_item_types;
+		internal_item_list->decode_extension_block_signatures = internal_batch->decode_extension_block_signatures;
+		internal_item_list->is_managed                        = 1;
+
+		if( libcdata_array_append_entry(
+		     internal_batch->item_lists_array,
+		     &item_list_index,
+		     (intptr_t *) item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append item list.",
+			 function );
+
+			goto on_error;
+		}
+		item_list = NULL;
+
+		number_of_item_lists++;
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	maximum_number_of_tasks = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_batch->number_of_threads > 1 )
+	{
+		maximum_number_of_tasks = internal_batch->number_of_threads * LIBFWSI_BATCH_TASKS_PER_THREAD;
+	}
+#endif
+	if( maximum_number_of_tasks > number_of_entries )
+	{
+		maximum_number_of_tasks = number_of_entries;
+	}
+	if( maximum_number_of_tasks > internal_batch->number_of_allocated_tasks )
+	{
+		reallocation = memory_reallocate(
+		                internal_batch->tasks,
+		                sizeof( libfwsi_batch_task_t ) * maximum_number_of_tasks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->tasks = (libfwsi_batch_task_t *) reallocation;
+
+		if( memory_set(
+		     &( internal_batch->tasks[ internal_batch->number_of_allocated_tasks ] ),
+		     0,
+		     sizeof( libfwsi_batch_task_t ) * ( maximum_number_of_tasks - internal_batch->number_of_allocated_tasks ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear tasks.",
+			 function );
+
+			return( -1 );
+		}
+		internal_batch->number_of_allocated_tasks = maximum_number_of_tasks;
+	}
+	/* The weight of an entry is its byte stream size plus a fixed weight
+	 * for the per entry overhead, the total weight is capped at SSIZE_MAX
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_weight = LIBFWSI_BATCH_ENTRY_WEIGHT;
+
+		if( byte_stream_sizes[ entry_index ] <= (size_t) ( SSIZE_MAX - LIBFWSI_BATCH_ENTRY_WEIGHT ) )
+		{
+			entry_weight += byte_stream_sizes[ entry_index ];
+		}
+		if( entry_weight > ( (size_t) SSIZE_MAX - total_weight ) )
+		{
+			total_weight = (size_t) SSIZE_MAX;
+		}
+		else
+		{
+			total_weight += entry_weight;
+		}
+	}
+	task_size = total_weight / maximum_number_of_tasks;
+
+	if( ( total_weight % maximum_number_of_tasks ) != 0 )
+	{
+		task_size += 1;
+	}
+	if( task_size < LIBFWSI_BATCH_MINIMUM_TASK_SIZE )
+	{
+		task_size = LIBFWSI_BATCH_MINIMUM_TASK_SIZE;
+	}
+	task_boundary = task_size;
+	task_index    = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_weight = LIBFWSI_BATCH_ENTRY_WEIGHT;
+
+		if( byte_stream_sizes[ entry_index ] <= (size_t) ( SSIZE_MAX - LIBFWSI_BATCH_ENTRY_WEIGHT ) )
+		{
+			entry_weight += byte_stream_sizes[ entry_index ];
+		}
+		if( entry_weight > ( (size_t) SSIZE_MAX - weight ) )
+		{
+			weight = (size_t) SSIZE_MAX;
+		}
+		else
+		{
+			weight += entry_weight;
+		}
+		if( ( entry_index == ( number_of_entries - 1 ) )
+		 || ( ( weight >= task_boundary )
+		  &&  ( task_index < ( maximum_number_of_tasks - 1 ) ) ) )
+		{
+			task = &( internal_batch->tasks[ task_index ] );
+
+			task->internal_batch    = internal_batch;
+			task->byte_streams      = byte_streams;
+			task->byte_stream_sizes = byte_stream_sizes;
+			task->ascii_codepage    = ascii_codepage;
+			task->first_entry_index = first_entry_index;
+			task->number_of_entries = entry_index + 1 - first_entry_index;
+			task->copy_result       = -1;
+
+			if( ( ( internal_batch->parse_flags & LIBFWSI_PARSE_FLAG_USE_ARENA ) != 0 )
+			 && ( task->arena == NULL ) )
+			{
+				if( libfwsi_arena_initialize(
+				     &( task->arena ),
+				     LIBFWSI_ITEM_LIST_ARENA_BLOCK_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create arena of task: %d.",
+					 function,
+					 task_index );
+
+					return( -1 );
+				}
+			}
+			while( task_boundary <= weight )
+			{
+				task_boundary += task_size;
+			}
+			first_entry_index = entry_index + 1;
+
+			task_index++;
+		}
+		/* Entries that are not copied, for example because the batch was aborted,
+		 * report a runtime parse error
+		 */
+		internal_batch->parse_errors[ entry_index ]        = LIBFWSI_PARSE_ERROR_RUNTIME;
+		internal_batch->parse_error_offsets[ entry_index ] = 0;
+	}
+	internal_batch->number_of_entries = number_of_entries;
+	internal_batch->number_of_tasks   = task_index;
+
+	return( 1 );
+
+on_error:
+	if( item_list != NULL )
+	{
+		libfwsi_internal_item_list_free(
+		 (libfwsi_internal_item_list_t **) &item_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies the item lists of the entries of a task from the byte streams
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_task_copy_from_byte_streams(
+     libfwsi_batch_task_t *task,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch         = NULL;
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_batch_task_copy_from_byte_streams";
+	int entry_index                                  = 0;
+	int last_entry_index                             = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid task - missing batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch   = task->internal_batch;
+	last_entry_index = task->first_entry_index + task->number_of_entries;
+
+	for( entry_index = task->first_entry_index;
+	     entry_index < last_entry_index;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->item_lists_array,
+		     entry_index,
+		     (intptr_t **) &internal_item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item list: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		internal_item_list->arena = task->arena;
+
+		/* The error is not set so that failing entries do not format error messages
+		 */
+		libfwsi_internal_item_list_copy_from_byte_stream(
+		 internal_item_list,
+		 task->byte_streams[ entry_index ],
+		 task->byte_stream_sizes[ entry_index ],
+		 task->ascii_codepage,
+		 &( internal_batch->parse_errors[ entry_index ] ),
+		 &( internal_batch->parse_error_offsets[ entry_index ] ),
+		 NULL );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the batch thread pool to copy a task
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_task_copy_callback(
+     libfwsi_batch_task_t *task,
+     void *arguments LIBFWSI_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfwsi_batch_task_copy_callback";
+
+	LIBFWSI_UNREFERENCED_PARAMETER( arguments )
+
+	if( task == NULL )
+	{
+		return( -1 );
+	}
+	task->copy_result = libfwsi_batch_task_copy_from_byte_streams(
+	                     task,
+	                     &error );
+
+	if( task->copy_result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to copy task.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( task->copy_result );
+}
+
+/* Copies the tasks of a batch using multiple threads
+ * The tasks are queued in entry order and every thread takes the next task from the queue
+ * when it has finished its previous task, hence threads that copy small entries take over
+ * the remaining work of threads that copy large entries
+ * Every entry stores its result by index, hence the results are in input order
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_batch_copy_multi_threaded(
+     libfwsi_internal_batch_t *internal_batch,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "libfwsi_internal_batch_copy_multi_threaded";
+	int number_of_threads                  = 0;
+	int task_index                         = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_threads = internal_batch->number_of_threads;
+
+	if( number_of_threads > internal_batch->number_of_tasks )
+	{
+		number_of_threads = internal_batch->number_of_tasks;
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_threads,
+	     internal_batch->number_of_tasks,
+	     (int (*)(intptr_t *, void *)) &libfwsi_batch_task_copy_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( task_index = 0;
+	     task_index < internal_batch->number_of_tasks;
+	     task_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) &( internal_batch->tasks[ task_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push task: %d onto thread pool queue.",
+			 function,
+			 task_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( task_index = 0;
+	     task_index < internal_batch->number_of_tasks;
+	     task_index++ )
+	{
+		if( internal_batch->tasks[ task_index ].copy_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to copy task: %d.",
+			 function,
+			 task_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Copies a batch of item lists from byte streams
+ * Every byte stream is parsed, a byte stream that cannot be parsed does not fail the batch
+ * but is reported by its parse error
+ * If more than 1 thread is set the entries are copied using multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_copy_from_byte_streams(
+     libfwsi_batch_t *batch,
+     const uint8_t * const *byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_copy_from_byte_streams";
+	int task_index                           = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_batch_prepare(
+	     internal_batch,
+	     byte_streams,
+	     byte_stream_sizes,
+	     number_of_byte_streams,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_batch->number_of_tasks > 1 )
+	{
+		if( libfwsi_internal_batch_copy_multi_threaded(
+		     internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy batch using multiple threads.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	for( task_index = 0;
+	     task_index < internal_batch->number_of_tasks;
+	     task_index++ )
+	{
+		if( libfwsi_batch_task_copy_from_byte_streams(
+		     &( internal_batch->tasks[ task_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy task: %d.",
+			 function,
+			 task_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries of the last batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_get_number_of_entries(
+     libfwsi_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_number_of_entries";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_batch->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the parse error of a specific entry
+ * The parse error is LIBFWSI_PARSE_ERROR_NONE if the entry was parsed successfully
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_batch_get_parse_error(
+     libfwsi_batch_t *batch,
+     int entry_index,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_parse_error";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_batch->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_error == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse error.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_error_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse error offset.",
+		 function );
+
+		return( -1 );
+	}
+	*parse_error        = internal_batch->parse_errors[ entry_index ];
+	*parse_error_offset = internal_batch->parse_error_offsets[ entry_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the item list of a specific entry
+ * The item list is owned by the batch and remains valid until the next batch is copied or the batch is freed,
+ * it should still be freed with libfwsi_item_list_free but this does not release its resources
+ * Returns 1 if successful, 0 if the entry could not be parsed or -1 on error
+ */
+int libfwsi_batch_get_item_list(
+     libfwsi_batch_t *batch,
+     int entry_index,
+     libfwsi_item_list_t **item_list,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_batch_t *internal_batch = NULL;
+	static char *function                    = "libfwsi_batch_get_item_list";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libfwsi_internal_batch_t *) batch;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_batch->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch->parse_errors[ entry_index ] != LIBFWSI_PARSE_ERROR_NONE )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->item_lists_array,
+	     entry_index,
+	     (intptr_t **) item_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item list: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
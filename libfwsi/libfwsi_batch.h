@@ -0,0 +1,252 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_BATCH_H )
+#define _LIBFWSI_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_arena.h"
+#include "libfwsi_extern.h"
+#include "libfwsi_libcdata.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of tasks per thread a batch is split into, so that threads
+ * that finish early pick up the remaining tasks
+ */
+#define LIBFWSI_BATCH_TASKS_PER_THREAD		8
+
+/* The minimum size of a task in bytes
+ */
+#define LIBFWSI_BATCH_MINIMUM_TASK_SIZE		( 64 * 1024 )
+
+/* The size an entry is weighted with in addition to its byte stream size
+ */
+#define LIBFWSI_BATCH_ENTRY_WEIGHT		64
+
+typedef struct libfwsi_internal_batch libfwsi_internal_batch_t;
+
+typedef struct libfwsi_batch_task libfwsi_batch_task_t;
+
+struct libfwsi_batch_task
+{
+	/* The batch
+	 */
+	libfwsi_internal_batch_t *internal_batch;
+
+	/* The byte streams
+	 */
+	const uint8_t * const *byte_streams;
+
+	/* The byte stream sizes
+	 */
+	const size_t *byte_stream_sizes;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The index of the first entry of the task
+	 */
+	int first_entry_index;
+
+	/* The number of entries of the task
+	 */
+	int number_of_entries;
+
+	/* The arena the items of the item lists of the task are allocated from
+	 */
+	libfwsi_arena_t *arena;
+
+	/* The copy result, 1 if successful or -1 on error
+	 */
+	int copy_result;
+};
+
+struct libfwsi_internal_batch
+{
+	/* The parse flags
+	 */
+	uint32_t parse_flags;
+
+	/* The item types of which the values are decoded
+	 */
+	uint32_t decode_item_types;
+
+	/* The extension block signatures of which the values are decoded
+	 */
+	uint64_t decode_extension_block_signatures;
+
+	/* The item lists array, contains the item lists that are reused between batches
+	 */
+	libcdata_array_t *item_lists_array;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The parse errors of the entries
+	 */
+	int *parse_errors;
+
+	/* The parse error offsets of the entries
+	 */
+	size_t *parse_error_offsets;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The tasks
+	 */
+	libfwsi_batch_task_t *tasks;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_initialize(
+     libfwsi_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_free(
+     libfwsi_batch_t **batch,
+     libcerror_error_t **error );
+
+int libfwsi_internal_batch_free_item_lists(
+     libfwsi_internal_batch_t *internal_batch,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_parse_flags(
+     libfwsi_batch_t *batch,
+     uint32_t *parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_set_parse_flags(
+     libfwsi_batch_t *batch,
+     uint32_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_decode_types(
+     libfwsi_batch_t *batch,
+     uint32_t *item_types,
+     uint64_t *extension_block_signatures,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_set_decode_types(
+     libfwsi_batch_t *batch,
+     uint32_t item_types,
+     uint64_t extension_block_signatures,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_number_of_threads(
+     libfwsi_batch_t *batch,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_set_number_of_threads(
+     libfwsi_batch_t *batch,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfwsi_internal_batch_prepare(
+     libfwsi_internal_batch_t *internal_batch,
+     const uint8_t * const *byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_entries,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwsi_batch_task_copy_from_byte_streams(
+     libfwsi_batch_task_t *task,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwsi_batch_task_copy_callback(
+     libfwsi_batch_task_t *task,
+     void *arguments );
+
+int libfwsi_internal_batch_copy_multi_threaded(
+     libfwsi_internal_batch_t *internal_batch,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_copy_from_byte_streams(
+     libfwsi_batch_t *batch,
+     const uint8_t * const *byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_number_of_entries(
+     libfwsi_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_parse_error(
+     libfwsi_batch_t *batch,
+     int entry_index,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_batch_get_item_list(
+     libfwsi_batch_t *batch,
+     int entry_index,
+     libfwsi_item_list_t **item_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_BATCH_H ) */
+
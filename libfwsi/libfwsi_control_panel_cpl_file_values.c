@@ -29,6 +29,7 @@
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 
 /* Creates control panel CPL file values
  * Make sure the value control_panel_cpl_file_values is referencing, is set to NULL
@@ -264,18 +265,10 @@ ssize_t libfwsi_control_panel_cpl_file_values_read(
 
 	if( shell_item_data_offset <= ( shell_item_data_size - 2 ) )
 	{
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size += 2 )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -303,18 +296,10 @@ ssize_t libfwsi_control_panel_cpl_file_values_read(
 	}
 	if( shell_item_data_offset <= ( shell_item_data_size - 2 ) )
 	{
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size += 2 )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -342,18 +327,10 @@ ssize_t libfwsi_control_panel_cpl_file_values_read(
 	}
 	if( shell_item_data_offset <= ( shell_item_data_size - 2 ) )
 	{
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size += 2 )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
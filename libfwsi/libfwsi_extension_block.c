@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block.h"
 #include "libfwsi_extension_block_0xbeef0000_values.h"
@@ -40,11 +41,13 @@
 #include "libfwsi_types.h"
 
 /* Creates an extension block
+ * If the arena is set the extension block is allocated from the arena
  * Make sure the value extension_block is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_extension_block_initialize(
      libfwsi_extension_block_t **extension_block,
+     libfwsi_arena_t *arena,
      libcerror_error_t **error )
 {
 	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
@@ -72,10 +75,11 @@ int libfwsi_extension_block_initialize(
 
 		return( -1 );
 	}
-	internal_extension_block = memory_allocate_structure(
-	                            libfwsi_internal_extension_block_t );
-
-	if( internal_extension_block == NULL )
+	if( libfwsi_arena_allocate(
+	     arena,
+	     sizeof( libfwsi_internal_extension_block_t ),
+	     (void **) &internal_extension_block,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -100,12 +104,15 @@ int libfwsi_extension_block_initialize(
 
 		goto on_error;
 	}
+	internal_extension_block->arena = arena;
+
 	*extension_block = (libfwsi_extension_block_t *) internal_extension_block;
 
 	return( 1 );
 
 on_error:
-	if( internal_extension_block != NULL )
+	if( ( internal_extension_block != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_extension_block );
@@ -163,6 +170,14 @@ int libfwsi_internal_extension_block_free(
 	}
 	if( *internal_extension_block != NULL )
 	{
+		/* An extension block allocated from an arena is released with the arena
+		 */
+		if( ( *internal_extension_block )->arena != NULL )
+		{
+			*internal_extension_block = NULL;
+
+			return( 1 );
+		}
 		if( ( *internal_extension_block )->value != NULL )
 		{
 			if( ( *internal_extension_block )->free_value != NULL )
@@ -182,6 +197,20 @@ int libfwsi_internal_extension_block_free(
 				}
 			}
 		}
+		if( libfwsi_string_cache_free(
+		     &( ( *internal_extension_block )->string_cache ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *internal_extension_block );
 
@@ -260,8 +289,10 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		return( 1 );
 	}
 	/* Do not try to parse unsupported extension block sizes
+	 * or byte streams too small to contain the signature
 	 */
-	if( data_size < 10 )
+	if( ( data_size < 10 )
+	 || ( byte_stream_size < 8 ) )
 	{
 		return( 0 );
 	}
@@ -312,13 +343,23 @@ int libfwsi_extension_block_copy_from_byte_stream(
 	internal_extension_block->data_size = data_size;
 	internal_extension_block->signature = signature;
 
-	switch( internal_extension_block->signature )
+	/* The values of extension blocks with a signature that is not selected are not decoded
+	 */
+	if( ( ( signature & 0x0000ffc0UL ) == 0 )
+	 && ( ( internal_extension_block->skip_signatures & ( (uint64_t) 1 << ( signature & 0x0000003fUL ) ) ) != 0 ) )
+	{
+		signature = 0;
+	}
+	switch( signature )
 	{
 		case 0xbeef0000UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_free;
 
-			if( libfwsi_extension_block_0xbeef0000_values_initialize(
-			     (libfwsi_extension_block_0xbeef0000_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0000_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -352,8 +393,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0001UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_free;
 
-			if( libfwsi_extension_block_0xbeef0001_values_initialize(
-			     (libfwsi_extension_block_0xbeef0001_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0001_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -387,8 +431,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0003UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_free;
 
-			if( libfwsi_extension_block_0xbeef0003_values_initialize(
-			     (libfwsi_extension_block_0xbeef0003_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0003_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -422,8 +469,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0004UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_free;
 
-			if( libfwsi_file_entry_extension_values_initialize(
-			     (libfwsi_file_entry_extension_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_file_entry_extension_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -440,6 +490,8 @@ int libfwsi_extension_block_copy_from_byte_stream(
 			              byte_stream,
 			              internal_extension_block->data_size,
 			              ascii_codepage,
+			              internal_extension_block->arena,
+			              internal_extension_block->borrow_data,
 			              error );
 
 			if( read_count == -1 )
@@ -458,8 +510,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0005UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_free;
 
-			if( libfwsi_extension_block_0xbeef0005_values_initialize(
-			     (libfwsi_extension_block_0xbeef0005_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0005_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -493,8 +548,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0006UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_free;
 
-			if( libfwsi_extension_block_0xbeef0006_values_initialize(
-			     (libfwsi_extension_block_0xbeef0006_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0006_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -528,8 +586,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0014UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_free;
 
-			if( libfwsi_extension_block_0xbeef0014_values_initialize(
-			     (libfwsi_extension_block_0xbeef0014_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0014_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -563,8 +624,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0019UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_free;
 
-			if( libfwsi_extension_block_0xbeef0019_values_initialize(
-			     (libfwsi_extension_block_0xbeef0019_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0019_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -598,8 +662,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
 		case 0xbeef0025UL:
 			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_free;
 
-			if( libfwsi_extension_block_0xbeef0025_values_initialize(
-			     (libfwsi_extension_block_0xbeef0025_values_t **) &( internal_extension_block->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_extension_block->arena,
+			     &( internal_extension_block->value ),
+			     sizeof( libfwsi_extension_block_0xbeef0025_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -689,11 +756,19 @@ int libfwsi_extension_block_copy_from_byte_stream(
 #endif
 	byte_stream_offset += 2;
 
+	if( internal_extension_block->borrow_data != 0 )
+	{
+		internal_extension_block->data = byte_stream;
+	}
 	return( 1 );
 
 on_error:
-	if( ( internal_extension_block->value != NULL )
-	 && ( internal_extension_block->free_value != NULL ) )
+	if( internal_extension_block->arena != NULL )
+	{
+		internal_extension_block->value = NULL;
+	}
+	else if( ( internal_extension_block->value != NULL )
+	      && ( internal_extension_block->free_value != NULL ) )
 	{
 		internal_extension_block->free_value(
 		 &( internal_extension_block->value ),
@@ -702,6 +777,106 @@ on_error:
 	return( -1 );
 }
 
+/* Validates a chain of extension blocks in a byte stream
+ * The chain ends at a terminator or at an extension block that is not supported,
+ * which is what libfwsi_extension_block_copy_from_byte_stream does as well
+ * This function does not allocate memory or set errors
+ * Returns 1 if the chain is valid or 0 if not
+ */
+int libfwsi_extension_blocks_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+	uint32_t signature        = 0;
+	uint16_t data_size        = 0;
+
+	if( byte_stream == NULL )
+	{
+		return( 0 );
+	}
+	while( ( byte_stream_size - byte_stream_offset ) > 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 data_size );
+
+		/* A terminator or an unsupported extension block size ends the chain
+		 */
+		if( data_size < 10 )
+		{
+			break;
+		}
+		if( ( byte_stream_size - byte_stream_offset ) < 8 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset + 4 ] ),
+		 signature );
+
+		if( ( signature >> 16 ) != 0xbeef )
+		{
+			break;
+		}
+		if( (size_t) data_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			return( 0 );
+		}
+		byte_stream_offset += data_size;
+	}
+	return( 1 );
+}
+
+/* Determines the number of extension blocks in a chain of extension blocks in a byte stream
+ * The count ends where libfwsi_extension_block_copy_from_byte_stream stops reading
+ * extension blocks or at an extension block size value that is out of bounds
+ * This function does not allocate memory or set errors
+ * Returns the number of extension blocks
+ */
+int libfwsi_extension_blocks_count(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size )
+{
+	size_t byte_stream_offset      = 0;
+	uint32_t signature             = 0;
+	uint16_t data_size             = 0;
+	int number_of_extension_blocks = 0;
+
+	if( byte_stream == NULL )
+	{
+		return( 0 );
+	}
+	while( ( byte_stream_size - byte_stream_offset ) > 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 data_size );
+
+		if( ( data_size < 10 )
+		 || ( (size_t) data_size > ( byte_stream_size - byte_stream_offset ) ) )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset + 4 ] ),
+		 signature );
+
+		if( ( signature >> 16 ) != 0xbeef )
+		{
+			break;
+		}
+		if( number_of_extension_blocks == INT_MAX )
+		{
+			break;
+		}
+		byte_stream_offset += data_size;
+
+		number_of_extension_blocks++;
+	}
+	return( number_of_extension_blocks );
+}
+
 /* Retrieves the signature
  * Returns 1 if successful or -1 on error
  */
@@ -782,3 +957,61 @@ int libfwsi_extension_block_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the data
+ * The data references the byte stream the extension block was read from and is not copied
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_extension_block_get_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_extension_block_get_data";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->data == NULL )
+	{
+		return( 0 );
+	}
+	*data      = internal_extension_block->data;
+	*data_size = (size_t) internal_extension_block->data_size;
+
+	return( 1 );
+}
+
@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_extern.h"
+#include "libfwsi_string.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -49,6 +51,20 @@ struct libfwsi_internal_extension_block
 	 */
 	uint32_t signature;
 
+	/* The data, references the byte stream the extension block was read from
+	 * when the item it is part of borrows its data
+	 */
+	const uint8_t *data;
+
+	/* Value to indicate the extension block should reference the byte stream it is read from
+	 * including its strings
+	 */
+	uint8_t borrow_data;
+
+	/* The signatures of which the values are not decoded, as bit ( 1 << ( signature & 0x3f ) )
+	 */
+	uint64_t skip_signatures;
+
 	/* The extension block value
 	 */
         intptr_t *value;
@@ -58,10 +74,19 @@ struct libfwsi_internal_extension_block
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
+
+	/* The arena the extension block is allocated from
+	 */
+	libfwsi_arena_t *arena;
+
+	/* The cache of the UTF-8 strings of the extension block value, created on first use
+	 */
+	libfwsi_string_cache_t *string_cache;
 };
 
 int libfwsi_extension_block_initialize(
      libfwsi_extension_block_t **extension_block,
+     libfwsi_arena_t *arena,
      libcerror_error_t **error );
 
 LIBFWSI_EXTERN \
@@ -80,6 +105,14 @@ int libfwsi_extension_block_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwsi_extension_blocks_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size );
+
+int libfwsi_extension_blocks_count(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size );
+
 LIBFWSI_EXTERN \
 int libfwsi_extension_block_get_signature(
      libfwsi_extension_block_t *extension_block,
@@ -92,6 +125,13 @@ int libfwsi_extension_block_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_extension_block_get_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
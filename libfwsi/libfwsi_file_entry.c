@@ -29,6 +29,7 @@
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_item.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 
 /* Retrieves the file size
  * Returns 1 if successful or -1 on error
@@ -278,16 +279,15 @@ int libfwsi_file_entry_get_utf8_name_size(
 
 	if( file_entry_values->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libfwsi_string_get_utf8_size_from_utf16_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
-			  LIBUNA_ENDIAN_LITTLE,
 			  utf8_string_size,
 			  error );
 	}
 	else
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
+		result = libfwsi_string_get_utf8_size_from_byte_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
 		          internal_item->ascii_codepage,
@@ -361,17 +361,16 @@ int libfwsi_file_entry_get_utf8_name(
 
 	if( file_entry_values->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = libfwsi_string_copy_utf8_from_utf16_stream(
 		          utf8_string,
 		          utf8_string_size,
 			  file_entry_values->name,
 			  file_entry_values->name_size,
-			  LIBUNA_ENDIAN_LITTLE,
 			  error );
 	}
 	else
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libfwsi_string_copy_utf8_from_byte_stream(
 		          utf8_string,
 		          utf8_string_size,
 			  file_entry_values->name,
@@ -393,6 +392,213 @@ int libfwsi_file_entry_get_utf8_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted name and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_file_entry_get_utf8_name_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_name_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_file_entry_values_t *file_entry_values = NULL;
+	static char *function                          = "libfwsi_file_entry_get_utf8_name_and_size";
+	int string_type                                = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+	if( utf8_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_values->is_unicode != 0 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+	}
+	else
+	{
+		string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     file_entry_values->name,
+	     file_entry_values->name_size,
+	     string_type,
+	     internal_item->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_name_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted name from the string cache of the item
+ * The UTF-8 string is converted when first retrieved and remains valid until the item is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_entry_get_cached_utf8_name(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_file_entry_values_t *file_entry_values = NULL;
+	static char *function                          = "libfwsi_file_entry_get_cached_utf8_name";
+	int string_type                                = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_values->is_unicode != 0 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+	}
+	else
+	{
+		string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     LIBFWSI_FILE_ENTRY_STRING_CACHE_INDEX_NAME,
+	     file_entry_values->name,
+	     file_entry_values->name_size,
+	     string_type,
+	     internal_item->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted name
  * Returns 1 if successful or -1 on error
  */
@@ -560,3 +766,96 @@ int libfwsi_file_entry_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the name data
+ * The name data is a UTF-16 little-endian string if is Unicode is set otherwise
+ * an extended ASCII string in the codepage of the item, and is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_entry_get_name_data(
+     libfwsi_item_t *item,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint8_t *is_unicode,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_file_entry_values_t *file_entry_values = NULL;
+	static char *function                          = "libfwsi_file_entry_get_name_data";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_unicode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is Unicode.",
+		 function );
+
+		return( -1 );
+	}
+	*name_data      = file_entry_values->name;
+	*name_data_size = file_entry_values->name_size;
+	*is_unicode     = file_entry_values->is_unicode;
+
+	return( 1 );
+}
+
@@ -33,6 +33,13 @@
 extern "C" {
 #endif
 
+/* The indexes of the strings in the string cache of a file entry
+ */
+enum LIBFWSI_FILE_ENTRY_STRING_CACHE_INDEXES
+{
+	LIBFWSI_FILE_ENTRY_STRING_CACHE_INDEX_NAME	= 0
+};
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_get_file_size(
      libfwsi_item_t *item,
@@ -64,6 +71,21 @@ int libfwsi_file_entry_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_utf8_name_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_name_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_cached_utf8_name(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_get_utf16_name_size(
      libfwsi_item_t *item,
@@ -77,6 +99,14 @@ int libfwsi_file_entry_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_name_data(
+     libfwsi_item_t *item,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint8_t *is_unicode,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
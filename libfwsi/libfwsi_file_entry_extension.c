@@ -28,6 +28,7 @@
 #include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 
 /* Retrieves the creation time
  * The returned time is a 32-bit version of a FAT date time value
@@ -285,10 +286,9 @@ int libfwsi_file_entry_extension_get_utf8_long_name_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libfwsi_string_get_utf8_size_from_utf16_stream(
 	     file_entry_extension_values->long_name,
 	     file_entry_extension_values->long_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -359,12 +359,11 @@ int libfwsi_file_entry_extension_get_utf8_long_name(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libfwsi_string_copy_utf8_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     file_entry_extension_values->long_name,
 	     file_entry_extension_values->long_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -379,6 +378,208 @@ int libfwsi_file_entry_extension_get_utf8_long_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted long name and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, the size is 0 when not available,
+ * a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if not available or the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+     libfwsi_extension_block_t *extension_block,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_long_name_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_utf8_long_name_and_size";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( utf8_long_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 long name size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_long_name_size = 0;
+
+	if( ( file_entry_extension_values->long_name == NULL )
+	 || ( file_entry_extension_values->long_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     file_entry_extension_values->long_name,
+	     file_entry_extension_values->long_name_size,
+	     LIBFWSI_STRING_TYPE_UTF16_STREAM,
+	     file_entry_extension_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_long_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_long_name_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted long name from the string cache of the extension block
+ * The UTF-8 string is converted when first retrieved and remains valid until the extension block is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf8_long_name(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_cached_utf8_long_name";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_extension_values->long_name == NULL )
+	 || ( file_entry_extension_values->long_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_extension_block->string_cache ),
+	     internal_extension_block->arena,
+	     LIBFWSI_FILE_ENTRY_EXTENSION_STRING_CACHE_INDEX_LONG_NAME,
+	     file_entry_extension_values->long_name,
+	     file_entry_extension_values->long_name_size,
+	     LIBFWSI_STRING_TYPE_UTF16_STREAM,
+	     file_entry_extension_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted long name
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -527,6 +728,90 @@ int libfwsi_file_entry_extension_get_utf16_long_name(
 	return( 1 );
 }
 
+/* Retrieves the long name data
+ * The long name data is a UTF-16 little-endian string and is not copied
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_long_name_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **long_name_data,
+     size_t *long_name_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_long_name_data";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( long_name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( long_name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_extension_values->long_name == NULL )
+	 || ( file_entry_extension_values->long_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*long_name_data      = file_entry_extension_values->long_name;
+	*long_name_data_size = file_entry_extension_values->long_name_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 formatted localized name
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -584,16 +869,15 @@ int libfwsi_file_entry_extension_get_utf8_localized_name_size(
 	}
 	if( internal_extension_block->version >= 7 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = libfwsi_string_get_utf8_size_from_utf16_stream(
 		          file_entry_extension_values->localized_name,
 		          file_entry_extension_values->localized_name_size,
-		          LIBUNA_ENDIAN_LITTLE,
 		          utf8_string_size,
 		          error );
 	}
 	else if( internal_extension_block->version >= 3 )
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
+		result = libfwsi_string_get_utf8_size_from_byte_stream(
 		          file_entry_extension_values->localized_name,
 		          file_entry_extension_values->localized_name_size,
 		          file_entry_extension_values->ascii_codepage,
@@ -676,17 +960,16 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
 	}
 	if( internal_extension_block->version >= 7 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = libfwsi_string_copy_utf8_from_utf16_stream(
 		          utf8_string,
 		          utf8_string_size,
 		          file_entry_extension_values->localized_name,
 		          file_entry_extension_values->localized_name_size,
-		          LIBUNA_ENDIAN_LITTLE,
 		          error );
 	}
 	else if( internal_extension_block->version >= 3 )
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libfwsi_string_copy_utf8_from_byte_stream(
 		          utf8_string,
 		          utf8_string_size,
 		          file_entry_extension_values->localized_name,
@@ -712,6 +995,234 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted localized name and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, the size is 0 when not available,
+ * a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if not available or the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+     libfwsi_extension_block_t *extension_block,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_localized_name_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_utf8_localized_name_and_size";
+	int string_type                                                    = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( utf8_localized_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 localized name size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_localized_name_size = 0;
+
+	if( ( file_entry_extension_values->localized_name == NULL )
+	 || ( file_entry_extension_values->localized_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_extension_block->version >= 7 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+	}
+	else if( internal_extension_block->version >= 3 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     file_entry_extension_values->localized_name,
+	     file_entry_extension_values->localized_name_size,
+	     string_type,
+	     file_entry_extension_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_localized_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_localized_name_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted localized name from the string cache of the extension block
+ * The UTF-8 string is converted when first retrieved and remains valid until the extension block is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_cached_utf8_localized_name";
+	int string_type                                                    = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->signature != 0xbeef0004UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry_extension_values->localized_name == NULL )
+	 || ( file_entry_extension_values->localized_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_extension_block->version >= 7 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+	}
+	else if( internal_extension_block->version >= 3 )
+	{
+		string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_extension_block->string_cache ),
+	     internal_extension_block->arena,
+	     LIBFWSI_FILE_ENTRY_EXTENSION_STRING_CACHE_INDEX_LOCALIZED_NAME,
+	     file_entry_extension_values->localized_name,
+	     file_entry_extension_values->localized_name_size,
+	     string_type,
+	     file_entry_extension_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted localized name
  * Returns 1 if successful, 0 if not available or -1 on error
  */
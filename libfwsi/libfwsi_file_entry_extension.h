@@ -33,6 +33,14 @@
 extern "C" {
 #endif
 
+/* The indexes of the strings in the string cache of a file entry extension
+ */
+enum LIBFWSI_FILE_ENTRY_EXTENSION_STRING_CACHE_INDEXES
+{
+	LIBFWSI_FILE_ENTRY_EXTENSION_STRING_CACHE_INDEX_LONG_NAME	= 0,
+	LIBFWSI_FILE_ENTRY_EXTENSION_STRING_CACHE_INDEX_LOCALIZED_NAME	= 1
+};
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_creation_time(
      libfwsi_extension_block_t *extension_block,
@@ -64,6 +72,21 @@ int libfwsi_file_entry_extension_get_utf8_long_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+     libfwsi_extension_block_t *extension_block,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_long_name_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf8_long_name(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_utf16_long_name_size(
      libfwsi_extension_block_t *extension_block,
@@ -77,6 +100,13 @@ int libfwsi_file_entry_extension_get_utf16_long_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_long_name_data(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **long_name_data,
+     size_t *long_name_data_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_utf8_localized_name_size(
      libfwsi_extension_block_t *extension_block,
@@ -90,6 +120,21 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+     libfwsi_extension_block_t *extension_block,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_localized_name_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+     libfwsi_extension_block_t *extension_block,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_file_entry_extension_get_utf16_localized_name_size(
      libfwsi_extension_block_t *extension_block,
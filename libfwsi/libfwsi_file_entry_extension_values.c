@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_file_entry_extension_values.h"
@@ -31,6 +32,7 @@
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 
 /* Creates file entry extension values
  * Make sure the value file_entry_extension_values is referencing, is set to NULL
@@ -127,12 +129,16 @@ int libfwsi_file_entry_extension_values_free(
 	}
 	if( *file_entry_extension_values != NULL )
 	{
-		if( ( *file_entry_extension_values )->long_name != NULL )
+		if( ( ( *file_entry_extension_values )->long_name != NULL )
+		 && ( ( *file_entry_extension_values )->long_name != ( *file_entry_extension_values )->inline_long_name )
+		 && ( ( *file_entry_extension_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *file_entry_extension_values )->long_name );
 		}
-		if( ( *file_entry_extension_values )->localized_name != NULL )
+		if( ( ( *file_entry_extension_values )->localized_name != NULL )
+		 && ( ( *file_entry_extension_values )->localized_name != ( *file_entry_extension_values )->inline_localized_name )
+		 && ( ( *file_entry_extension_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *file_entry_extension_values )->localized_name );
@@ -153,6 +159,8 @@ ssize_t libfwsi_file_entry_extension_values_read(
          const uint8_t *extension_block_data,
          size_t extension_block_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error )
 {
 	static char *function              = "libfwsi_file_entry_extension_values_read";
@@ -286,6 +294,8 @@ ssize_t libfwsi_file_entry_extension_values_read(
 		 value_16bit );
 	}
 #endif
+	file_entry_extension_values->strings_are_borrowed = borrow_data;
+
 	extension_block_data_offset = 18;
 
 	if( version >= 7 )
@@ -394,47 +404,50 @@ ssize_t libfwsi_file_entry_extension_values_read(
 	}
 	/* Determine the long name size
 	 */
-	for( string_size = extension_block_data_offset;
-	     ( string_size + 1 ) < extension_block_data_size - 2;
-	     string_size += 2 )
-	{
-		if( ( extension_block_data[ string_size ] == 0 )
-		 && ( extension_block_data[ string_size + 1 ] == 0 ) )
-		{
-			string_size += 2;
-
-			break;
-		}
-	}
-	string_size -= extension_block_data_offset;
+	string_size = libfwsi_string_get_utf16_stream_string_size(
+	              extension_block_data,
+	              extension_block_data_size - 2,
+	              extension_block_data_offset );
 
-	file_entry_extension_values->long_name = (uint8_t *) memory_allocate(
-	                                                      sizeof( uint8_t ) * string_size );
-
-	if( file_entry_extension_values->long_name == NULL )
+	if( borrow_data != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create long name.",
-		 function );
-
-		goto on_error;
+		file_entry_extension_values->long_name = (uint8_t *) &( extension_block_data[ extension_block_data_offset ] );
 	}
-	if( memory_copy(
-	     file_entry_extension_values->long_name,
-	     &( extension_block_data[ extension_block_data_offset ] ),
-	     string_size ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy long name.",
-		 function );
+		if( string_size <= LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LONG_NAME_SIZE )
+		{
+			file_entry_extension_values->long_name = file_entry_extension_values->inline_long_name;
+		}
+		else if( libfwsi_arena_allocate(
+		          arena,
+		          sizeof( uint8_t ) * string_size,
+		          (void **) &( file_entry_extension_values->long_name ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create long name.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( memory_copy(
+		     file_entry_extension_values->long_name,
+		     &( extension_block_data[ extension_block_data_offset ] ),
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy long name.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	file_entry_extension_values->long_name_size = string_size;
 
@@ -468,47 +481,50 @@ ssize_t libfwsi_file_entry_extension_values_read(
 		{
 			/* Determine the localized name size
 			 */
-			for( string_size = extension_block_data_offset;
-			     ( string_size + 1 ) < extension_block_data_size - 2;
-			     string_size += 2 )
+			string_size = libfwsi_string_get_utf16_stream_string_size(
+			              extension_block_data,
+			              extension_block_data_size - 2,
+			              extension_block_data_offset );
+
+			if( borrow_data != 0 )
+			{
+				file_entry_extension_values->localized_name = (uint8_t *) &( extension_block_data[ extension_block_data_offset ] );
+			}
+			else
 			{
-				if( ( extension_block_data[ string_size ] == 0 )
-				 && ( extension_block_data[ string_size + 1 ] == 0 ) )
+				if( string_size <= LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LOCALIZED_NAME_SIZE )
 				{
-					string_size += 2;
-
-					break;
+					file_entry_extension_values->localized_name = file_entry_extension_values->inline_localized_name;
 				}
-			}
-			string_size -= extension_block_data_offset;
+				else if( libfwsi_arena_allocate(
+				          arena,
+				          sizeof( uint8_t ) * string_size,
+				          (void **) &( file_entry_extension_values->localized_name ),
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create localized name.",
+					 function );
 
-			file_entry_extension_values->localized_name = (uint8_t *) memory_allocate(
-			                                                           sizeof( uint8_t ) * string_size );
+					goto on_error;
+				}
+				if( memory_copy(
+				     file_entry_extension_values->localized_name,
+				     &( extension_block_data[ extension_block_data_offset ] ),
+				     string_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy localized name.",
+					 function );
 
-			if( file_entry_extension_values->localized_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create localized name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     file_entry_extension_values->localized_name,
-			     &( extension_block_data[ extension_block_data_offset ] ),
-			     string_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy localized name.",
-				 function );
-
-				goto on_error;
+					goto on_error;
+				}
 			}
 			file_entry_extension_values->localized_name_size = string_size;
 
@@ -539,46 +555,50 @@ ssize_t libfwsi_file_entry_extension_values_read(
 		{
 			/* Determine the localized name size
 			 */
-			for( string_size = extension_block_data_offset;
-			     string_size < extension_block_data_size - 2;
-			     string_size += 1 )
+			string_size = libfwsi_string_get_byte_stream_string_size(
+			              extension_block_data,
+			              extension_block_data_size - 2,
+			              extension_block_data_offset );
+
+			if( borrow_data != 0 )
+			{
+				file_entry_extension_values->localized_name = (uint8_t *) &( extension_block_data[ extension_block_data_offset ] );
+			}
+			else
 			{
-				if( extension_block_data[ string_size ] == 0 )
+				if( string_size <= LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LOCALIZED_NAME_SIZE )
 				{
-					string_size += 1;
-
-					break;
+					file_entry_extension_values->localized_name = file_entry_extension_values->inline_localized_name;
 				}
-			}
-			string_size -= extension_block_data_offset;
+				else if( libfwsi_arena_allocate(
+				          arena,
+				          sizeof( uint8_t ) * string_size,
+				          (void **) &( file_entry_extension_values->localized_name ),
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create localized name.",
+					 function );
 
-			file_entry_extension_values->localized_name = (uint8_t *) memory_allocate(
-			                                                           sizeof( uint8_t ) * string_size );
+					goto on_error;
+				}
+				if( memory_copy(
+				     file_entry_extension_values->localized_name,
+				     &( extension_block_data[ extension_block_data_offset ] ),
+				     string_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy localized name.",
+					 function );
 
-			if( file_entry_extension_values->localized_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create localized name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     file_entry_extension_values->localized_name,
-			     &( extension_block_data[ extension_block_data_offset ] ),
-			     string_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy localized name.",
-				 function );
-
-				goto on_error;
+					goto on_error;
+				}
 			}
 			file_entry_extension_values->localized_name_size = string_size;
 
@@ -612,18 +632,26 @@ ssize_t libfwsi_file_entry_extension_values_read(
 on_error:
 	if( file_entry_extension_values->localized_name != NULL )
 	{
-		memory_free(
-		 file_entry_extension_values->localized_name );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( file_entry_extension_values->localized_name != file_entry_extension_values->inline_localized_name ) )
+		{
+			memory_free(
+			 file_entry_extension_values->localized_name );
+		}
 		file_entry_extension_values->localized_name = NULL;
 	}
 	file_entry_extension_values->localized_name_size = 0;
 
 	if( file_entry_extension_values->long_name != NULL )
 	{
-		memory_free(
-		 file_entry_extension_values->long_name );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( file_entry_extension_values->long_name != file_entry_extension_values->inline_long_name ) )
+		{
+			memory_free(
+			 file_entry_extension_values->long_name );
+		}
 		file_entry_extension_values->long_name = NULL;
 	}
 	file_entry_extension_values->long_name_size = 0;
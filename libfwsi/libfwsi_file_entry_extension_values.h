@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_extension_block.h"
 
@@ -32,6 +33,14 @@
 extern "C" {
 #endif
 
+/* The size of the inline long name, longer long names are allocated separately
+ */
+#define LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LONG_NAME_SIZE	64
+
+/* The size of the inline localized name, longer localized names are allocated separately
+ */
+#define LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LOCALIZED_NAME_SIZE	32
+
 typedef struct libfwsi_file_entry_extension_values libfwsi_file_entry_extension_values_t;
 
 struct libfwsi_file_entry_extension_values
@@ -56,6 +65,10 @@ struct libfwsi_file_entry_extension_values
 	 */
 	size_t long_name_size;
 
+	/* The inline long name, used for long names that fit
+	 */
+	uint8_t inline_long_name[ LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LONG_NAME_SIZE ];
+
 	/* The localized name
 	 */
 	uint8_t *localized_name;
@@ -64,9 +77,17 @@ struct libfwsi_file_entry_extension_values
 	 */
 	size_t localized_name_size;
 
+	/* The inline localized name, used for localized names that fit
+	 */
+	uint8_t inline_localized_name[ LIBFWSI_FILE_ENTRY_EXTENSION_VALUES_INLINE_LOCALIZED_NAME_SIZE ];
+
 	/* The ASCII codepage
 	 */
 	int ascii_codepage;
+
+	/* Value to indicate if the strings reference the extension block data instead of a copy
+	 */
+	uint8_t strings_are_borrowed;
 };
 
 int libfwsi_file_entry_extension_values_initialize(
@@ -82,6 +103,8 @@ ssize_t libfwsi_file_entry_extension_values_read(
          const uint8_t *extension_block_data,
          size_t extension_block_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error );
 
 #if defined( __cplusplus )
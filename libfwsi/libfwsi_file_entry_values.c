@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_file_attributes.h"
@@ -34,6 +35,7 @@
 #include "libfwsi_libfguid.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string.h"
 #include "libfwsi_unused.h"
 
 /* Creates file entry values
@@ -131,7 +133,9 @@ int libfwsi_file_entry_values_free(
 	}
 	if( *file_entry_values != NULL )
 	{
-		if( ( *file_entry_values )->name != NULL )
+		if( ( ( *file_entry_values )->name != NULL )
+		 && ( ( *file_entry_values )->name != ( *file_entry_values )->inline_name )
+		 && ( ( *file_entry_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *file_entry_values )->name );
@@ -152,6 +156,8 @@ ssize_t libfwsi_file_entry_values_read(
          const uint8_t *shell_item_data,
          size_t shell_item_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error )
 {
 	static char *function          = "libfwsi_file_entry_values_read";
@@ -274,6 +280,8 @@ ssize_t libfwsi_file_entry_values_read(
 		 "\n" );
 	}
 #endif
+	file_entry_values->strings_are_borrowed = borrow_data;
+
 	shell_item_data_offset = 14;
 
 	/* Check for SWN1 signature at offset -30
@@ -296,39 +304,24 @@ ssize_t libfwsi_file_entry_values_read(
 	{
 		file_entry_values->is_unicode = 0;
 	}
-	string_size = shell_item_data_offset;
-
 	/* Determine the size of the primary name
 	 */
 	if( file_entry_values->is_unicode != 0 )
 	{
-		while( ( string_size + 1 ) < shell_item_data_size )
-		{
-			if( ( shell_item_data[ string_size ] == 0 )
-			 && ( shell_item_data[ string_size + 1 ] == 0 ) )
-			{
-				string_size += 2;
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
-				break;
-			}
-			string_size += 2;
-		}
-		string_size          -= shell_item_data_offset;
 		string_alignment_size = 0;
 	}
 	else
 	{
-		while( string_size < shell_item_data_size )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size++;
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
-				break;
-			}
-			string_size++;
-		}
-		string_size          -= shell_item_data_offset;
 		string_alignment_size = string_size % 2;
 	}
 	if( string_size > (size_t) SSIZE_MAX )
@@ -342,33 +335,45 @@ ssize_t libfwsi_file_entry_values_read(
 
 		goto on_error;
 	}
-	file_entry_values->name = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * string_size );
-
-	if( file_entry_values->name == NULL )
+	if( borrow_data != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create name.",
-		 function );
-
-		goto on_error;
+		file_entry_values->name = (uint8_t *) &( shell_item_data[ shell_item_data_offset ] );
 	}
-	if( memory_copy(
-	     file_entry_values->name,
-	     &( shell_item_data[ shell_item_data_offset ] ),
-	     string_size ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy name.",
-		 function );
+		if( string_size <= LIBFWSI_FILE_ENTRY_VALUES_INLINE_NAME_SIZE )
+		{
+			file_entry_values->name = file_entry_values->inline_name;
+		}
+		else if( libfwsi_arena_allocate(
+		          arena,
+		          sizeof( uint8_t ) * string_size,
+		          (void **) &( file_entry_values->name ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( memory_copy(
+		     file_entry_values->name,
+		     &( shell_item_data[ shell_item_data_offset ] ),
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	file_entry_values->name_size = string_size;
 
@@ -437,38 +442,22 @@ ssize_t libfwsi_file_entry_values_read(
 	{
 		file_entry_values->in_pre_xp_format = 1;
 
-		string_size = shell_item_data_offset;
-
 		/* Determine the size of the secondary name
 		 */
 		if( file_entry_values->is_unicode != 0 )
 		{
-			while( ( string_size + 1 ) < shell_item_data_size )
-			{
-				if( ( shell_item_data[ string_size ] == 0 )
-				 && ( shell_item_data[ string_size + 1 ] == 0 ) )
-				{
-					string_size += 2;
-
-					break;
-				}
-				string_size += 2;
-			}
+			string_size = libfwsi_string_get_utf16_stream_string_size(
+			              shell_item_data,
+			              shell_item_data_size,
+			              shell_item_data_offset );
 		}
 		else
 		{
-			while( string_size < shell_item_data_size )
-			{
-				if( shell_item_data[ string_size ] == 0 )
-				{
-					string_size++;
-
-					break;
-				}
-				string_size++;
-			}
+			string_size = libfwsi_string_get_byte_stream_string_size(
+			              shell_item_data,
+			              shell_item_data_size,
+			              shell_item_data_offset );
 		}
-		string_size -= shell_item_data_offset;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -657,9 +646,13 @@ ssize_t libfwsi_file_entry_values_read(
 on_error:
 	if( file_entry_values->name != NULL )
 	{
-		memory_free(
-		 file_entry_values->name );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( file_entry_values->name != file_entry_values->inline_name ) )
+		{
+			memory_free(
+			 file_entry_values->name );
+		}
 		file_entry_values->name = NULL;
 	}
 	file_entry_values->name_size = 0;
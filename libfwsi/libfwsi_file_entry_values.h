@@ -25,12 +25,17 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the inline name, longer names are allocated separately
+ */
+#define LIBFWSI_FILE_ENTRY_VALUES_INLINE_NAME_SIZE	16
+
 typedef struct libfwsi_file_entry_values libfwsi_file_entry_values_t;
 
 struct libfwsi_file_entry_values
@@ -55,6 +60,10 @@ struct libfwsi_file_entry_values
 	 */
 	size_t name_size;
 
+	/* The inline name, used for names that fit
+	 */
+	uint8_t inline_name[ LIBFWSI_FILE_ENTRY_VALUES_INLINE_NAME_SIZE ];
+
 	/* Value to indicate if the file entry is in the pre XP format
 	 */
 	uint8_t in_pre_xp_format;
@@ -62,6 +71,10 @@ struct libfwsi_file_entry_values
 	/* Value to indicate if the strings are Unicode
 	 */
 	uint8_t is_unicode;
+
+	/* Value to indicate if the strings reference the shell item data instead of a copy
+	 */
+	uint8_t strings_are_borrowed;
 };
 
 int libfwsi_file_entry_values_initialize(
@@ -77,6 +90,8 @@ ssize_t libfwsi_file_entry_values_read(
          const uint8_t *shell_item_data,
          size_t shell_item_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -22,8 +22,10 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_delegate_values.h"
 #include "libfwsi_cdburn_values.h"
 #include "libfwsi_compressed_folder_values.h"
@@ -34,9 +36,12 @@
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block.h"
 #include "libfwsi_file_attributes.h"
+#include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_game_folder_values.h"
 #include "libfwsi_item.h"
+#include "libfwsi_item_classifier.h"
+#include "libfwsi_known_folder_identifier.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -48,6 +53,7 @@
 #include "libfwsi_network_location_values.h"
 #include "libfwsi_root_folder_values.h"
 #include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string.h"
 #include "libfwsi_types.h"
 #include "libfwsi_unknown_0x74_values.h"
 #include "libfwsi_uri_values.h"
@@ -89,6 +95,7 @@ int libfwsi_item_initialize(
 	}
 	if( libfwsi_internal_item_initialize(
 	     &internal_item,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -106,11 +113,13 @@ int libfwsi_item_initialize(
 }
 
 /* Creates an item
+ * If the arena is set the item is allocated from the arena
  * Make sure the value item is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_internal_item_initialize(
      libfwsi_internal_item_t **internal_item,
+     libfwsi_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libfwsi_internal_item_initialize";
@@ -137,10 +146,11 @@ int libfwsi_internal_item_initialize(
 
 		return( -1 );
 	}
-	*internal_item = memory_allocate_structure(
-	                  libfwsi_internal_item_t );
-
-	if( *internal_item == NULL )
+	if( libfwsi_arena_allocate(
+	     arena,
+	     sizeof( libfwsi_internal_item_t ),
+	     (void **) internal_item,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -165,29 +175,131 @@ int libfwsi_internal_item_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( ( *internal_item )->extension_blocks_array ),
-	     0,
+	( *internal_item )->arena = arena;
+
+	/* An item allocated from an arena stores its extension blocks in the arena
+	 */
+	if( arena == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( ( *internal_item )->extension_blocks_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extension blocks array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *internal_item != NULL )
+	{
+		if( arena == NULL )
+		{
+			memory_free(
+			 *internal_item );
+		}
+		*internal_item = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates an item that is allocated as a single block of memory
+ * The block contains the item, its values, extension blocks and strings
+ * and is sized from the item data size
+ * Make sure the value item is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_initialize_single_allocation(
+     libfwsi_internal_item_t **internal_item,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_t *arena = NULL;
+	static char *function  = "libfwsi_internal_item_initialize_single_allocation";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *internal_item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extension blocks, their values and the strings are estimated
+	 * at twice the item data size, if more space is needed the arena
+	 * allocates an additional block
+	 */
+	if( libfwsi_arena_initialize_in_first_block(
+	     &arena,
+	     sizeof( libfwsi_internal_item_t ) + LIBFWSI_ITEM_SINGLE_ALLOCATION_VALUES_SIZE + ( 2 * data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwsi_internal_item_initialize(
+	     internal_item,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extension blocks array.",
+		 "%s: unable to create item.",
 		 function );
 
 		goto on_error;
 	}
+	( *internal_item )->owns_arena = 1;
+
 	return( 1 );
 
 on_error:
-	if( *internal_item != NULL )
+	if( arena != NULL )
 	{
-		memory_free(
-		 *internal_item );
-
-		*internal_item = NULL;
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -246,8 +358,10 @@ int libfwsi_internal_item_free(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error )
 {
-	static char *function = "libfwsi_internal_item_free";
-	int result            = 1;
+	libfwsi_arena_t *arena = NULL;
+	static char *function  = "libfwsi_internal_item_free";
+	uint8_t owns_arena     = 0;
+	int result             = 1;
 
 	if( internal_item == NULL )
 	{
@@ -262,6 +376,33 @@ int libfwsi_internal_item_free(
 	}
 	if( *internal_item != NULL )
 	{
+		/* An item allocated from an arena is released with the arena
+		 */
+		if( ( *internal_item )->arena != NULL )
+		{
+			/* The item is stored in the arena it owns
+			 */
+			arena      = ( *internal_item )->arena;
+			owns_arena = ( *internal_item )->owns_arena;
+
+			*internal_item = NULL;
+
+			if( ( owns_arena != 0 )
+			 && ( libfwsi_arena_free(
+			       &arena,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
 		if( ( *internal_item )->value != NULL )
 		{
 			if( ( *internal_item )->free_value != NULL )
@@ -295,6 +436,25 @@ int libfwsi_internal_item_free(
 
 			result = -1;
 		}
+		if( libfwsi_string_cache_free(
+		     &( ( *internal_item )->string_cache ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *internal_item )->owns_data != 0 )
+		{
+			memory_free(
+			 (uint8_t *) ( *internal_item )->data );
+		}
 		memory_free(
 		 *internal_item );
 
@@ -303,6 +463,102 @@ int libfwsi_internal_item_free(
 	return( result );
 }
 
+/* Clears an item for reuse
+ * This frees the item value and extension blocks but retains
+ * the capacity of the extension blocks array
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_clear(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_clear";
+	int result            = 1;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->arena == NULL )
+	{
+		if( ( internal_item->value != NULL )
+		 && ( internal_item->free_value != NULL ) )
+		{
+			if( internal_item->free_value(
+			     &( internal_item->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_empty(
+		     internal_item->extension_blocks_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_extension_block_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to empty extension blocks array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_item->owns_data != 0 )
+		{
+			memory_free(
+			 (uint8_t *) internal_item->data );
+		}
+	}
+	if( libfwsi_string_cache_free(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free string cache.",
+		 function );
+
+		result = -1;
+	}
+	internal_item->type                                 = 0;
+	internal_item->class_type                           = 0;
+	internal_item->signature                            = 0;
+	internal_item->data_size                            = 0;
+	internal_item->extension_blocks_offset              = 0;
+	internal_item->data                                 = NULL;
+	internal_item->owns_data                            = 0;
+	internal_item->borrow_data                          = 0;
+	internal_item->skip_item_types                      = 0;
+	internal_item->skip_extension_block_signatures      = 0;
+	internal_item->value                                = NULL;
+	internal_item->free_value                           = NULL;
+	internal_item->extension_blocks                     = NULL;
+	internal_item->number_of_extension_blocks           = 0;
+	internal_item->number_of_allocated_extension_blocks = 0;
+	internal_item->ascii_codepage                       = 0;
+
+	return( result );
+}
+
 /* Copies a shell item from a byte stream
  * Returns 1 if successful or -1 on error
  */
@@ -320,7 +576,10 @@ int libfwsi_item_copy_from_byte_stream(
 	size_t shell_item_data_size                         = 0;
 	ssize_t read_count                                  = 0;
 	uint32_t signature                                  = 0;
-	int entry_index                                     = 0;
+	uint8_t *data                                       = NULL;
+	uint8_t skip_values                                 = 0;
+	int item_type                                       = 0;
+	int number_of_extension_blocks                      = 0;
 	int result                                          = 0;
 
 	if( item == NULL )
@@ -435,88 +694,17 @@ int libfwsi_item_copy_from_byte_stream(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 8 ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ 4 ] ),
-		 signature );
-
-		switch( signature )
-		{
-			case 0x39de2184UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY;
-				break;
-
-			/* "AugM" */
-			case 0x4d677541UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CDBURN;
-				break;
-
-			/* "GFSI" */
-			case 0x49534647UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_GAME_FOLDER;
-				break;
-
-			case 0xffffff38UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE;
-				break;
-
-			default:
-				break;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 10 ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ 6 ] ),
-		 signature );
-
-		switch( signature )
-		{
-			case 0x07192006UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY;
-				break;
-
-			case 0x10312005UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_VOLUME;
-				break;
-
-			case 0x10141981UL:
-			case 0x23a3dfd5UL:
-			case 0x23febbeeUL:
-			case 0x3b93afbbUL:
-			case 0xbeebee00UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW;
-				break;
-
-			case 0x46534643UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_UNKNOWN_0x74;
-				break;
-
-			default:
-				break;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 38 ) )
-	{
-		if( memory_compare(
-		     &( byte_stream[ internal_item->data_size - 32 ] ),
-		     libfwsi_delegate_item_identifier,
-		     16 ) == 0 )
-		{
-			internal_item->type = LIBFWSI_ITEM_TYPE_DELEGATE;
-		}
-	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 3 ) )
+	if( internal_item->type == 0 )
 	{
-		internal_item->class_type = byte_stream[ 2 ];
+		internal_item->type = libfwsi_item_classifier_classify(
+		                       byte_stream,
+		                       internal_item->data_size,
+		                       &( internal_item->class_type ),
+		                       &signature );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( ( libcnotify_verbose != 0 )
+		 && ( internal_item->class_type != 0 ) )
 		{
 			libcnotify_printf(
 			 "%s: class type indicator\t\t: 0x%02" PRIx8 "\n",
@@ -524,60 +712,34 @@ int libfwsi_item_copy_from_byte_stream(
 			 internal_item->class_type );
 		}
 #endif
-		switch( internal_item->class_type & 0x70 )
-		{
-			case 0x10:
-				if( internal_item->class_type == 0x1f )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_ROOT_FOLDER;
-				}
-				break;
-
-			case 0x20:
-				internal_item->type = LIBFWSI_ITEM_TYPE_VOLUME;
-				break;
-
-			case 0x30:
-				internal_item->type = LIBFWSI_ITEM_TYPE_FILE_ENTRY;
-				break;
-
-			case 0x40:
-				internal_item->type = LIBFWSI_ITEM_TYPE_NETWORK_LOCATION;
-				break;
-
-			case 0x50:
-				if( internal_item->class_type == 0x52 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-				}
-				break;
-
-			case 0x60:
-				if( internal_item->class_type == 0x61 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_URI;
-				}
-				break;
-	
-			case 0x70:
-				if( internal_item->class_type == 0x71 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL;
-				}
-				break;
+	}
+	item_type = internal_item->type;
 
-			default:
-				break;
+	/* The values and extension blocks of items with a type that is not selected are not decoded
+	 * but the item retains its type, class type and signature
+	 */
+	if( ( internal_item->skip_item_types & ( (uint32_t) 1 << item_type ) ) != 0 )
+	{
+		if( ( internal_item->class_type == 0 )
+		 && ( internal_item->type != LIBFWSI_ITEM_TYPE_UNKNOWN ) )
+		{
+			internal_item->signature = signature;
 		}
+		item_type   = LIBFWSI_ITEM_TYPE_UNKNOWN;
+		read_count  = internal_item->data_size;
+		skip_values = 1;
 	}
-	switch( internal_item->type )
+	switch( item_type )
 	{
 		case LIBFWSI_ITEM_TYPE_CDBURN:
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_free;
 
-			if( libfwsi_cdburn_values_initialize(
-			     (libfwsi_cdburn_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_cdburn_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -612,8 +774,11 @@ int libfwsi_item_copy_from_byte_stream(
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_free;
 
-			if( libfwsi_compressed_folder_values_initialize(
-			     (libfwsi_compressed_folder_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_compressed_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -647,8 +812,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_values_free;
 
-			if( libfwsi_control_panel_values_initialize(
-			     (libfwsi_control_panel_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_control_panel_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -682,8 +850,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_free;
 
-			if( libfwsi_control_panel_category_values_initialize(
-			     (libfwsi_control_panel_category_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_control_panel_category_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -717,8 +888,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_free;
 
-			if( libfwsi_control_panel_cpl_file_values_initialize(
-			     (libfwsi_control_panel_cpl_file_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_control_panel_cpl_file_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -753,8 +927,11 @@ int libfwsi_item_copy_from_byte_stream(
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_delegate_values_free;
 
-			if( libfwsi_delegate_values_initialize(
-			     (libfwsi_delegate_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_delegate_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_delegate_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -788,8 +965,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_free;
 
-			if( libfwsi_file_entry_values_initialize(
-			     (libfwsi_file_entry_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_file_entry_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -806,6 +986,8 @@ int libfwsi_item_copy_from_byte_stream(
 			              byte_stream,
 			              internal_item->data_size,
 			              ascii_codepage,
+			              internal_item->arena,
+			              internal_item->borrow_data,
 			              error );
 
 			if( read_count == -1 )
@@ -825,8 +1007,11 @@ int libfwsi_item_copy_from_byte_stream(
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_free;
 
-			if( libfwsi_game_folder_values_initialize(
-			     (libfwsi_game_folder_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_game_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -860,8 +1045,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_free;
 
-			if( libfwsi_network_location_values_initialize(
-			     (libfwsi_network_location_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_network_location_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -878,6 +1066,8 @@ int libfwsi_item_copy_from_byte_stream(
 			              byte_stream,
 			              internal_item->data_size,
 			              ascii_codepage,
+			              internal_item->arena,
+			              internal_item->borrow_data,
 			              error );
 
 			if( read_count == -1 )
@@ -897,8 +1087,11 @@ int libfwsi_item_copy_from_byte_stream(
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_free;
 
-			if( libfwsi_mtp_file_entry_values_initialize(
-			     (libfwsi_mtp_file_entry_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_mtp_file_entry_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -933,8 +1126,11 @@ int libfwsi_item_copy_from_byte_stream(
 			internal_item->signature  = signature;
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_free;
 
-			if( libfwsi_mtp_volume_values_initialize(
-			     (libfwsi_mtp_volume_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_mtp_volume_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -968,8 +1164,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_free;
 
-			if( libfwsi_root_folder_values_initialize(
-			     (libfwsi_root_folder_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_root_folder_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1003,8 +1202,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_URI:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_free;
 
-			if( libfwsi_uri_values_initialize(
-			     (libfwsi_uri_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_uri_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1039,8 +1241,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_free;
 
-			if( libfwsi_users_property_view_values_initialize(
-			     (libfwsi_users_property_view_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_users_property_view_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1075,8 +1280,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_VOLUME:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_free;
 
-			if( libfwsi_volume_values_initialize(
-			     (libfwsi_volume_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_volume_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1111,8 +1319,11 @@ int libfwsi_item_copy_from_byte_stream(
 		case LIBFWSI_ITEM_TYPE_UNKNOWN_0x74:
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_unknown_0x74_values_free;
 
-			if( libfwsi_unknown_0x74_values_initialize(
-			     (libfwsi_unknown_0x74_values_t **) &( internal_item->value ),
+			if( libfwsi_arena_initialize_value(
+			     internal_item->arena,
+			     &( internal_item->value ),
+			     sizeof( libfwsi_unknown_0x74_values_t ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_unknown_0x74_values_initialize,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1166,12 +1377,42 @@ int libfwsi_item_copy_from_byte_stream(
 	}
 	byte_stream_offset += read_count;
 
+	internal_item->extension_blocks_offset = (uint16_t) byte_stream_offset;
+
 	shell_item_data_size = internal_item->data_size - byte_stream_offset;
 
+	/* Determine the number of extension blocks up front so that
+	 * the extension blocks are stored without reallocations
+	 */
+	if( byte_stream_offset < internal_item->data_size )
+	{
+		number_of_extension_blocks = libfwsi_extension_blocks_count(
+		                              &( byte_stream[ byte_stream_offset ] ),
+		                              shell_item_data_size );
+	}
+
+	if( number_of_extension_blocks > 0 )
+	{
+		if( libfwsi_internal_item_reserve_extension_blocks(
+		     internal_item,
+		     number_of_extension_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to reserve extension blocks.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( shell_item_data_size > 2 )
 	{
 		if( libfwsi_extension_block_initialize(
 		     (libfwsi_extension_block_t **) &extension_block,
+		     internal_item->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1183,6 +1424,9 @@ int libfwsi_item_copy_from_byte_stream(
 
 			goto on_error;
 		}
+		extension_block->borrow_data     = internal_item->borrow_data;
+		extension_block->skip_signatures = internal_item->skip_extension_block_signatures;
+
 		result = libfwsi_extension_block_copy_from_byte_stream(
 		          extension_block,
 		          &( byte_stream[ byte_stream_offset ] ),
@@ -1212,10 +1456,9 @@ int libfwsi_item_copy_from_byte_stream(
 		{
 			break;
 		}
-		if( libcdata_array_append_entry(
-		     internal_item->extension_blocks_array,
-		     &entry_index,
-		     (intptr_t *) extension_block,
+		if( libfwsi_internal_item_append_extension_block(
+		     internal_item,
+		     extension_block,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1245,6 +1488,19 @@ int libfwsi_item_copy_from_byte_stream(
 			goto on_error;
 		}
 	}
+	if( libfwsi_internal_item_trim_extension_blocks(
+	     internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to trim extension blocks.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1260,41 +1516,529 @@ int libfwsi_item_copy_from_byte_stream(
 		}
 	}
 #endif
-	internal_item->ascii_codepage = ascii_codepage;
-
-	return( 1 );
-
-on_error:
-	if( extension_block != NULL )
+	if( internal_item->owns_data != 0 )
 	{
-		libfwsi_internal_extension_block_free(
-		 &extension_block,
-		 NULL );
+		memory_free(
+		 (uint8_t *) internal_item->data );
+
+		internal_item->data      = NULL;
+		internal_item->owns_data = 0;
 	}
-	if( ( internal_item->value != NULL )
-	 && ( internal_item->free_value != NULL ) )
+	if( internal_item->borrow_data != 0 )
 	{
-		internal_item->free_value(
-		 &( internal_item->value ),
-		 NULL );
+		internal_item->data = byte_stream;
 	}
-	return( -1 );
-}
-
-/* Retrieves the type
- * Returns 1 if successful or -1 on error
- */
-int libfwsi_item_get_type(
-     libfwsi_item_t *item,
-     int *type,
-     libcerror_error_t **error )
-{
-	libfwsi_internal_item_t *internal_item = NULL;
-	static char *function                  = "libfwsi_item_get_type";
-
-	if( item == NULL )
+	else if( skip_values != 0 )
 	{
-		libcerror_error_set(
+		/* The data of an item of which the values are not decoded is retained
+		 * so that it can be decoded by the caller
+		 */
+		if( internal_item->arena == NULL )
+		{
+			data = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * internal_item->data_size );
+
+			if( data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( libfwsi_arena_allocate(
+		          internal_item->arena,
+		          sizeof( uint8_t ) * internal_item->data_size,
+		          (void **) &data,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     data,
+		     byte_stream,
+		     (size_t) internal_item->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_item->data      = data;
+		internal_item->owns_data = (uint8_t) ( internal_item->arena == NULL );
+	}
+	internal_item->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( ( data != NULL )
+	 && ( internal_item->arena == NULL ) )
+	{
+		memory_free(
+		 data );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_internal_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	libfwsi_internal_item_trim_extension_blocks(
+	 internal_item,
+	 NULL );
+
+	if( internal_item->arena != NULL )
+	{
+		internal_item->value = NULL;
+	}
+	else if( ( internal_item->value != NULL )
+	      && ( internal_item->free_value != NULL ) )
+	{
+		internal_item->free_value(
+		 &( internal_item->value ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reserves space for a number of additional extension blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_reserve_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     int number_of_extension_blocks,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t **extension_blocks = NULL;
+	static char *function                                 = "libfwsi_internal_item_reserve_extension_blocks";
+	int number_of_allocated_extension_blocks              = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_extension_blocks < 0 )
+	 || ( number_of_extension_blocks > ( INT_MAX - internal_item->number_of_extension_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extension blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_extension_blocks = internal_item->number_of_extension_blocks + number_of_extension_blocks;
+
+	if( number_of_allocated_extension_blocks <= internal_item->number_of_allocated_extension_blocks )
+	{
+		return( 1 );
+	}
+	if( internal_item->arena == NULL )
+	{
+		/* The reserved entries are set by libfwsi_internal_item_append_extension_block
+		 * and the entries that remain unused are removed by libfwsi_internal_item_trim_extension_blocks
+		 */
+		if( libcdata_array_resize(
+		     internal_item->extension_blocks_array,
+		     number_of_allocated_extension_blocks,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_extension_block_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize extension blocks array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		/* The previous extension blocks are released with the arena
+		 */
+		if( libfwsi_arena_allocate(
+		     internal_item->arena,
+		     sizeof( libfwsi_internal_extension_block_t * ) * number_of_allocated_extension_blocks,
+		     (void **) &extension_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extension blocks.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_item->extension_blocks != NULL )
+		{
+			if( memory_copy(
+			     extension_blocks,
+			     internal_item->extension_blocks,
+			     sizeof( libfwsi_internal_extension_block_t * ) * internal_item->number_of_extension_blocks ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy extension blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_item->extension_blocks = extension_blocks;
+	}
+	internal_item->number_of_allocated_extension_blocks = number_of_allocated_extension_blocks;
+
+	return( 1 );
+}
+
+/* Removes the reserved extension blocks entries that were not used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_trim_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_trim_extension_blocks";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extension blocks of an item allocated from an arena are not stored in an array
+	 */
+	if( ( internal_item->arena != NULL )
+	 || ( internal_item->number_of_extension_blocks >= internal_item->number_of_allocated_extension_blocks ) )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_resize(
+	     internal_item->extension_blocks_array,
+	     internal_item->number_of_extension_blocks,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_extension_block_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize extension blocks array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item->number_of_allocated_extension_blocks = internal_item->number_of_extension_blocks;
+
+	return( 1 );
+}
+
+/* Appends an extension block
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_append_extension_block(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t **extension_blocks = NULL;
+	static char *function                                 = "libfwsi_internal_item_append_extension_block";
+	size_t extension_blocks_size                          = 0;
+	int entry_index                                       = 0;
+	int number_of_allocated_extension_blocks              = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->arena == NULL )
+	{
+		/* Use the entries that were reserved up front before appending
+		 */
+		if( internal_item->number_of_extension_blocks < internal_item->number_of_allocated_extension_blocks )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_item->extension_blocks_array,
+			     internal_item->number_of_extension_blocks,
+			     (intptr_t *) internal_extension_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set extension block in array.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libcdata_array_append_entry(
+			     internal_item->extension_blocks_array,
+			     &entry_index,
+			     (intptr_t *) internal_extension_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extension block to array.",
+				 function );
+
+				return( -1 );
+			}
+			internal_item->number_of_allocated_extension_blocks = entry_index + 1;
+		}
+		internal_item->number_of_extension_blocks += 1;
+
+		return( 1 );
+	}
+	if( internal_item->number_of_extension_blocks >= internal_item->number_of_allocated_extension_blocks )
+	{
+		if( internal_item->number_of_allocated_extension_blocks == 0 )
+		{
+			number_of_allocated_extension_blocks = 4;
+		}
+		else if( internal_item->number_of_allocated_extension_blocks < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_extension_blocks = internal_item->number_of_allocated_extension_blocks * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated extension blocks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		extension_blocks_size = sizeof( libfwsi_internal_extension_block_t * ) * number_of_allocated_extension_blocks;
+
+		/* The previous extension blocks are released with the arena
+		 */
+		if( libfwsi_arena_allocate(
+		     internal_item->arena,
+		     extension_blocks_size,
+		     (void **) &extension_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extension blocks.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_item->extension_blocks != NULL )
+		{
+			if( memory_copy(
+			     extension_blocks,
+			     internal_item->extension_blocks,
+			     sizeof( libfwsi_internal_extension_block_t * ) * internal_item->number_of_extension_blocks ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy extension blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_item->extension_blocks                     = extension_blocks;
+		internal_item->number_of_allocated_extension_blocks = number_of_allocated_extension_blocks;
+	}
+	internal_item->extension_blocks[ internal_item->number_of_extension_blocks ] = internal_extension_block;
+
+	internal_item->number_of_extension_blocks += 1;
+
+	return( 1 );
+}
+
+/* Determines the type of a shell item in a byte stream without reading the item
+ * The item is not validated beyond what is needed to determine its type
+ * Returns 1 if successful, 0 if the byte stream does not contain a shell item or -1 on error
+ */
+int libfwsi_item_classify(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int *item_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_classify";
+	uint32_t signature    = 0;
+	uint16_t data_size    = 0;
+	uint8_t class_type    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 3 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 data_size );
+
+	if( ( data_size < 3 )
+	 || ( (size_t) data_size > byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	*item_type = libfwsi_item_classifier_classify(
+	              byte_stream,
+	              data_size,
+	              &class_type,
+	              &signature );
+
+	return( 1 );
+}
+
+/* Validates the data of a shell item
+ * The caller is responsible for ensuring that the byte stream contains at least data_size bytes
+ * This function does not allocate memory or set errors
+ * Returns 1 if the shell item is valid or 0 if not
+ */
+int libfwsi_item_validate(
+     const uint8_t *byte_stream,
+     uint16_t data_size )
+{
+	uint32_t signature              = 0;
+	uint16_t extension_block_offset = 0;
+	uint8_t class_type              = 0;
+	int item_type                   = 0;
+
+	/* A shell item consists of at least the size and the class type indicator
+	 */
+	if( ( byte_stream == NULL )
+	 || ( data_size < 3 ) )
+	{
+		return( 0 );
+	}
+	item_type = libfwsi_item_classifier_classify(
+	             byte_stream,
+	             data_size,
+	             &class_type,
+	             &signature );
+
+	/* The last 2 bytes of a file entry shell item with extension blocks
+	 * contain the offset of the first extension block
+	 */
+	if( ( item_type != LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	 || ( data_size < 14 ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ data_size - 2 ] ),
+	 extension_block_offset );
+
+	if( ( extension_block_offset < 4 )
+	 || ( extension_block_offset > ( data_size - 10 ) ) )
+	{
+		return( 1 );
+	}
+	return( libfwsi_extension_blocks_validate(
+	         &( byte_stream[ extension_block_offset ] ),
+	         (size_t) ( data_size - extension_block_offset ) ) );
+}
+
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_type(
+     libfwsi_item_t *item,
+     int *type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_type";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
@@ -1441,6 +2185,65 @@ int libfwsi_item_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the data
+ * The data references the byte stream the item was read from and is not copied,
+ * except for the data of an item of which the values are not decoded
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_item_get_data(
+     libfwsi_item_t *item,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_data";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->data == NULL )
+	{
+		return( 0 );
+	}
+	*data      = internal_item->data;
+	*data_size = (size_t) internal_item->data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the number of extension blocks
  * Returns 1 if successful or -1 on error
  */
@@ -1465,6 +2268,23 @@ int libfwsi_item_get_number_of_extension_blocks(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
+	if( internal_item->arena != NULL )
+	{
+		if( number_of_extension_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of extension blocks.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_extension_blocks = internal_item->number_of_extension_blocks;
+
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_item->extension_blocks_array,
 	     number_of_extension_blocks,
@@ -1507,6 +2327,35 @@ int libfwsi_item_get_extension_block(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
+	if( internal_item->arena != NULL )
+	{
+		if( ( extension_block_index < 0 )
+		 || ( extension_block_index >= internal_item->number_of_extension_blocks ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extension block index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( extension_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid extension block.",
+			 function );
+
+			return( -1 );
+		}
+		*extension_block = (libfwsi_extension_block_t *) internal_item->extension_blocks[ extension_block_index ];
+
+		return( 1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_item->extension_blocks_array,
 	     extension_block_index,
@@ -1526,3 +2375,215 @@ int libfwsi_item_get_extension_block(
 	return( 1 );
 }
 
+
+/* Retrieves the string that represents the item in a path
+ * The long name of a file entry extension block is preferred over the file entry name
+ * and root folder, volume and known folder identifiers are resolved to their names
+ * The segment string type is set to a LIBFWSI_STRING_TYPE value
+ * and the ASCII codepage is used for byte stream segment strings
+ * Returns 1 if successful, 0 if the item has no path segment or -1 on error
+ */
+int libfwsi_internal_item_get_path_segment(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t **segment_string,
+     size_t *segment_string_size,
+     int *segment_string_type,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_extension_block_t *extension_block                         = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	libfwsi_file_entry_values_t *file_entry_values                     = NULL;
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_network_location_values_t *network_location_values         = NULL;
+	libfwsi_root_folder_values_t *root_folder_values                   = NULL;
+	libfwsi_users_property_view_values_t *users_property_view_values   = NULL;
+	libfwsi_volume_values_t *volume_values                             = NULL;
+	const char *folder_name                                            = NULL;
+	static char *function                                              = "libfwsi_internal_item_get_path_segment";
+	int extension_block_index                                          = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment string.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_string_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment string type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		return( 0 );
+	}
+	switch( internal_item->type )
+	{
+		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
+			for( extension_block_index = 0;
+			     extension_block_index < internal_item->number_of_extension_blocks;
+			     extension_block_index++ )
+			{
+				if( libfwsi_item_get_extension_block(
+				     (libfwsi_item_t *) internal_item,
+				     extension_block_index,
+				     &extension_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve extension block: %d.",
+					 function,
+					 extension_block_index );
+
+					return( -1 );
+				}
+				internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+				if( ( internal_extension_block == NULL )
+				 || ( internal_extension_block->signature != 0xbeef0004UL )
+				 || ( internal_extension_block->value == NULL ) )
+				{
+					continue;
+				}
+				file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+				if( ( file_entry_extension_values->long_name != NULL )
+				 && ( file_entry_extension_values->long_name_size > 2 ) )
+				{
+					*segment_string      = file_entry_extension_values->long_name;
+					*segment_string_size = file_entry_extension_values->long_name_size;
+					*segment_string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+					*ascii_codepage      = file_entry_extension_values->ascii_codepage;
+
+					return( 1 );
+				}
+			}
+			file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+			if( ( file_entry_values->name == NULL )
+			 || ( file_entry_values->name_size == 0 ) )
+			{
+				return( 0 );
+			}
+			*segment_string      = file_entry_values->name;
+			*segment_string_size = file_entry_values->name_size;
+			*ascii_codepage      = internal_item->ascii_codepage;
+
+			if( file_entry_values->is_unicode != 0 )
+			{
+				*segment_string_type = LIBFWSI_STRING_TYPE_UTF16_STREAM;
+			}
+			else
+			{
+				*segment_string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+			}
+			return( 1 );
+
+		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
+			network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+			if( ( network_location_values->location == NULL )
+			 || ( network_location_values->location_size == 0 ) )
+			{
+				return( 0 );
+			}
+			*segment_string      = network_location_values->location;
+			*segment_string_size = network_location_values->location_size;
+			*segment_string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+			*ascii_codepage      = network_location_values->ascii_codepage;
+
+			return( 1 );
+
+		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
+			root_folder_values = (libfwsi_root_folder_values_t *) internal_item->value;
+
+			folder_name = libfwsi_shell_folder_identifier_get_name(
+			               root_folder_values->shell_folder_identifier );
+			break;
+
+		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
+			users_property_view_values = (libfwsi_users_property_view_values_t *) internal_item->value;
+
+			if( users_property_view_values->has_known_folder_identifier == 0 )
+			{
+				return( 0 );
+			}
+			folder_name = libfwsi_known_folder_identifier_get_name(
+			               users_property_view_values->known_folder_identifier );
+			break;
+
+		case LIBFWSI_ITEM_TYPE_VOLUME:
+			volume_values = (libfwsi_volume_values_t *) internal_item->value;
+
+			if( volume_values->has_name != 0 )
+			{
+				*segment_string      = volume_values->name;
+				*segment_string_size = volume_values->name_size;
+				*segment_string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+				*ascii_codepage      = volume_values->ascii_codepage;
+
+				return( 1 );
+			}
+			folder_name = libfwsi_shell_folder_identifier_get_name(
+			               volume_values->shell_folder_identifier );
+			break;
+
+		default:
+			return( 0 );
+	}
+	*segment_string      = (const uint8_t *) folder_name;
+	*segment_string_size = narrow_string_length(
+	                        folder_name ) + 1;
+	*segment_string_type = LIBFWSI_STRING_TYPE_BYTE_STREAM;
+	*ascii_codepage      = LIBFWSI_CODEPAGE_ASCII;
+
+	return( 1 );
+}
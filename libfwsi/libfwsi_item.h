@@ -25,15 +25,22 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
+#include "libfwsi_extension_block.h"
 #include "libfwsi_extern.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
+#include "libfwsi_string.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size reserved for the item values when the item is allocated as a single block
+ */
+#define LIBFWSI_ITEM_SINGLE_ALLOCATION_VALUES_SIZE	256
+
 typedef struct libfwsi_internal_item libfwsi_internal_item_t;
 
 struct libfwsi_internal_item
@@ -54,6 +61,34 @@ struct libfwsi_internal_item
 	 */
 	uint16_t data_size;
 
+	/* The offset of the first extension block relative to the start of the item
+	 */
+	uint16_t extension_blocks_offset;
+
+	/* The data, references the byte stream the item was read from
+	 * when borrow data is set, otherwise the values of the item were
+	 * not decoded and the data is a copy owned by the item
+	 */
+	const uint8_t *data;
+
+	/* Value to indicate the item owns the data
+	 */
+	uint8_t owns_data;
+
+	/* Value to indicate the item should reference the byte stream it is read from
+	 * including the strings of its values
+	 */
+	uint8_t borrow_data;
+
+	/* The item types of which the values are not decoded, as bit ( 1 << type )
+	 */
+	uint32_t skip_item_types;
+
+	/* The extension block signatures of which the values are not decoded,
+	 * as bit ( 1 << ( signature & 0x3f ) )
+	 */
+	uint64_t skip_extension_block_signatures;
+
 	/* The item value
 	 */
         intptr_t *value;
@@ -68,10 +103,36 @@ struct libfwsi_internal_item
 	 */
 	libcdata_array_t *extension_blocks_array;
 
+	/* The extension blocks, used instead of the extension blocks array
+	 * when the item is allocated from an arena
+	 */
+	libfwsi_internal_extension_block_t **extension_blocks;
+
+	/* The number of extension blocks
+	 */
+	int number_of_extension_blocks;
+
+	/* The number of allocated extension blocks, when the item is not allocated
+	 * from an arena these are the entries of the extension blocks array
+	 */
+	int number_of_allocated_extension_blocks;
+
+	/* The arena the item is allocated from
+	 */
+	libfwsi_arena_t *arena;
+
+	/* Value to indicate the item owns the arena it is allocated from
+	 */
+	uint8_t owns_arena;
+
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
 
+	/* The cache of the UTF-8 strings of the item value, created on first use
+	 */
+	libfwsi_string_cache_t *string_cache;
+
 	/* Value to indicate if the item is managed by the list
 	 */
 	uint8_t is_managed;
@@ -84,6 +145,12 @@ int libfwsi_item_initialize(
 
 int libfwsi_internal_item_initialize(
      libfwsi_internal_item_t **internal_item,
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_initialize_single_allocation(
+     libfwsi_internal_item_t **internal_item,
+     size_t data_size,
      libcerror_error_t **error );
 
 LIBFWSI_EXTERN \
@@ -95,6 +162,10 @@ int libfwsi_internal_item_free(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_clear(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_copy_from_byte_stream(
      libfwsi_item_t *item,
@@ -103,6 +174,31 @@ int libfwsi_item_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_reserve_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     int number_of_extension_blocks,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_trim_extension_blocks(
+     libfwsi_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_append_extension_block(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_classify(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int *item_type,
+     libcerror_error_t **error );
+
+int libfwsi_item_validate(
+     const uint8_t *byte_stream,
+     uint16_t data_size );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_type(
      libfwsi_item_t *item,
@@ -127,6 +223,13 @@ int libfwsi_item_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_get_data(
+     libfwsi_item_t *item,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_number_of_extension_blocks(
      libfwsi_item_t *item,
@@ -140,6 +243,14 @@ int libfwsi_item_get_extension_block(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_get_path_segment(
+     libfwsi_internal_item_t *internal_item,
+     const uint8_t **segment_string,
+     size_t *segment_string_size,
+     int *segment_string_type,
+     int *ascii_codepage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
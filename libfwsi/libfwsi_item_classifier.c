@@ -0,0 +1,140 @@
+/*
+ * Shell item classifier functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_delegate_values.h"
+#include "libfwsi_item_classifier.h"
+
+/* The signatures at offset 4 indexed by a minimal perfect hash
+ * of the signature: ( signature * 0x00000005 ) >> 30
+ */
+const libfwsi_item_classifier_signature_t libfwsi_item_classifier_signatures_at_offset4[ 4 ] = {
+	{ 0x39de2184UL, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY },
+	/* "GFSI" */
+	{ 0x49534647UL, LIBFWSI_ITEM_TYPE_GAME_FOLDER },
+	/* "AugM" */
+	{ 0x4d677541UL, LIBFWSI_ITEM_TYPE_CDBURN },
+	{ 0xffffff38UL, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE } };
+
+/* The signatures at offset 6 indexed by a minimal perfect hash
+ * of the signature: ( signature * 0x00000451 ) >> 29
+ */
+const libfwsi_item_classifier_signature_t libfwsi_item_classifier_signatures_at_offset6[ 8 ] = {
+	{ 0xbeebee00UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0x3b93afbbUL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0x23febbeeUL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0x10141981UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0x46534643UL, LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 },
+	{ 0x07192006UL, LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY },
+	{ 0x23a3dfd5UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 0x10312005UL, LIBFWSI_ITEM_TYPE_MTP_VOLUME } };
+
+/* The class types indexed by the class type group: ( class_type & 0x70 ) >> 4
+ */
+const libfwsi_item_classifier_class_type_t libfwsi_item_classifier_class_types[ 8 ] = {
+	{ LIBFWSI_ITEM_TYPE_UNKNOWN, 0x00 },
+	{ LIBFWSI_ITEM_TYPE_ROOT_FOLDER, 0x1f },
+	{ LIBFWSI_ITEM_TYPE_VOLUME, 0x00 },
+	{ LIBFWSI_ITEM_TYPE_FILE_ENTRY, 0x00 },
+	{ LIBFWSI_ITEM_TYPE_NETWORK_LOCATION, 0x00 },
+	{ LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER, 0x52 },
+	{ LIBFWSI_ITEM_TYPE_URI, 0x61 },
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL, 0x71 } };
+
+/* Determines the item type of a shell item
+ * The caller is responsible for ensuring that the byte stream contains at least data_size bytes
+ * The class type is set when the item type was determined by the class type, otherwise 0,
+ * the signature is set to the last signature value that was read, otherwise 0
+ * Returns the item type (LIBFWSI_ITEM_TYPE_UNKNOWN if not known)
+ */
+int libfwsi_item_classifier_classify(
+     const uint8_t *byte_stream,
+     uint16_t data_size,
+     uint8_t *class_type,
+     uint32_t *signature )
+{
+	const libfwsi_item_classifier_class_type_t *class_type_entry = NULL;
+	const libfwsi_item_classifier_signature_t *signature_entry   = NULL;
+	uint32_t signature_value                                     = 0;
+
+	*class_type = 0;
+	*signature  = 0;
+
+	if( data_size >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 signature_value );
+
+		*signature = signature_value;
+
+		signature_entry = &( libfwsi_item_classifier_signatures_at_offset4[ (uint32_t) ( signature_value * 0x00000005UL ) >> 30 ] );
+
+		if( signature_entry->signature == signature_value )
+		{
+			return( (int) signature_entry->item_type );
+		}
+	}
+	if( data_size >= 10 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ 6 ] ),
+		 signature_value );
+
+		*signature = signature_value;
+
+		signature_entry = &( libfwsi_item_classifier_signatures_at_offset6[ (uint32_t) ( signature_value * 0x00000451UL ) >> 29 ] );
+
+		if( signature_entry->signature == signature_value )
+		{
+			return( (int) signature_entry->item_type );
+		}
+	}
+	if( data_size >= 38 )
+	{
+		if( memory_compare(
+		     &( byte_stream[ data_size - 32 ] ),
+		     libfwsi_delegate_item_identifier,
+		     16 ) == 0 )
+		{
+			return( LIBFWSI_ITEM_TYPE_DELEGATE );
+		}
+	}
+	if( data_size >= 3 )
+	{
+		*class_type = byte_stream[ 2 ];
+
+		class_type_entry = &( libfwsi_item_classifier_class_types[ ( *class_type & 0x70 ) >> 4 ] );
+
+		if( ( class_type_entry->class_type == 0 )
+		 || ( class_type_entry->class_type == *class_type ) )
+		{
+			return( (int) class_type_entry->item_type );
+		}
+	}
+	return( LIBFWSI_ITEM_TYPE_UNKNOWN );
+}
+
@@ -0,0 +1,75 @@
+/*
+ * Shell item classifier functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ITEM_CLASSIFIER_H )
+#define _LIBFWSI_ITEM_CLASSIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_item_classifier_signature libfwsi_item_classifier_signature_t;
+
+struct libfwsi_item_classifier_signature
+{
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The item type
+	 */
+	uint8_t item_type;
+};
+
+typedef struct libfwsi_item_classifier_class_type libfwsi_item_classifier_class_type_t;
+
+struct libfwsi_item_classifier_class_type
+{
+	/* The item type
+	 */
+	uint8_t item_type;
+
+	/* The class type required for the item type or 0 if any class type of the group applies
+	 */
+	uint8_t class_type;
+};
+
+extern const libfwsi_item_classifier_signature_t libfwsi_item_classifier_signatures_at_offset4[ 4 ];
+
+extern const libfwsi_item_classifier_signature_t libfwsi_item_classifier_signatures_at_offset6[ 8 ];
+
+extern const libfwsi_item_classifier_class_type_t libfwsi_item_classifier_class_types[ 8 ];
+
+int libfwsi_item_classifier_classify(
+     const uint8_t *byte_stream,
+     uint16_t data_size,
+     uint8_t *class_type,
+     uint32_t *signature );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_CLASSIFIER_H ) */
+
@@ -24,12 +24,17 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
 #include "libfwsi_item.h"
 #include "libfwsi_item_list.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 #include "libfwsi_types.h"
 
 /* Creates an item list
@@ -107,6 +112,9 @@ int libfwsi_item_list_initialize(
 
 		goto on_error;
 	}
+	internal_item_list->decode_item_types                 = LIBFWSI_DECODE_ITEM_TYPES_ALL;
+	internal_item_list->decode_extension_block_signatures = LIBFWSI_DECODE_EXTENSION_BLOCK_SIGNATURES_ALL;
+
 	*item_list = (libfwsi_item_list_t *) internal_item_list;
 
 	return( 1 );
@@ -121,6 +129,8 @@ on_error:
 }
 
 /* Frees an item list
+ * If the items are allocated from an arena they are released with the arena
+ * An item list that is managed by a batch is released with the batch
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_item_list_free(
@@ -145,11 +155,62 @@ int libfwsi_item_list_free(
 	if( *item_list != NULL )
 	{
 		internal_item_list = (libfwsi_internal_item_list_t *) *item_list;
-		*item_list         = NULL;
 
+		if( internal_item_list->is_managed == 0 )
+		{
+			if( libfwsi_internal_item_list_free(
+			     &internal_item_list,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*item_list = NULL;
+	}
+	return( result );
+}
+
+/* Frees an item list
+ * The arena of an item list that is managed by a batch is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_free(
+     libfwsi_internal_item_list_t **internal_item_list,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwsi_internal_item_list_free";
+	int (*entry_free_function)(
+	       intptr_t **entry,
+	       libcerror_error_t **error ) = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free;
+	int result                        = 1;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *internal_item_list != NULL )
+	{
+		if( ( *internal_item_list )->arena != NULL )
+		{
+			entry_free_function = NULL;
+		}
 		if( libcdata_array_free(
-		     &( internal_item_list->items_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+		     &( ( *internal_item_list )->items_array ),
+		     entry_free_function,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -161,28 +222,90 @@ int libfwsi_item_list_free(
 
 			result = -1;
 		}
+		if( ( ( *internal_item_list )->arena != NULL )
+		 && ( ( *internal_item_list )->is_managed == 0 ) )
+		{
+			if( libfwsi_arena_free(
+			     &( ( *internal_item_list )->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_item_list )->visit_arena != NULL )
+		{
+			if( libfwsi_arena_free(
+			     &( ( *internal_item_list )->visit_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free visit arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_item_list )->recycled_items_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *internal_item_list )->recycled_items_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free the recycled items array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_item_list )->item_offsets != NULL )
+		{
+			memory_free(
+			 ( *internal_item_list )->item_offsets );
+		}
+		if( ( *internal_item_list )->data != NULL )
+		{
+			memory_free(
+			 ( *internal_item_list )->data );
+		}
 		memory_free(
-		 internal_item_list );
+		 *internal_item_list );
+
+		*internal_item_list = NULL;
 	}
 	return( result );
 }
 
-/* Copies a shell item list from a byte stream
+/* Clears an item list for reuse
+ * The items are retained so they can be reused by a subsequent copy from byte stream,
+ * if the items are allocated from an arena the arena memory is reused instead
+ * Any item previously retrieved from the item list is no longer valid after clearing
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_copy_from_byte_stream(
+int libfwsi_item_list_clear(
      libfwsi_item_list_t *item_list,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int ascii_codepage,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
 	libfwsi_internal_item_t *internal_shell_item     = NULL;
-	static char *function                            = "libfwsi_item_list_copy_from_byte_stream";
-	uint16_t shell_item_size                         = 0;
-	int item_list_index                              = 0;
-	int shell_item_index                             = 0;
+	static char *function                            = "libfwsi_item_list_clear";
+	int entry_index                                  = 0;
+	int item_index                                   = 0;
+	int number_of_items                              = 0;
 
 	if( item_list == NULL )
 	{
@@ -197,173 +320,169 @@ int libfwsi_item_list_copy_from_byte_stream(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( byte_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
-		 function );
-
-		return( -1 );
-	}
-	if( byte_stream_size < 2 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: byte stream too small.",
-		 function );
-
-		return( -1 );
-	}
-	if( byte_stream_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: byte stream size exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
-		 function );
-
-		return( -1 );
-	}
-	while( byte_stream_size > 0 )
+	if( internal_item_list->arena == NULL )
 	{
-		byte_stream_copy_to_uint16_little_endian(
-		 byte_stream,
-		 shell_item_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
-			 function,
-			 shell_item_index,
-			 shell_item_size );
-		}
-#endif
-		if( shell_item_size > byte_stream_size )
+		if( libcdata_array_get_number_of_entries(
+		     internal_item_list->items_array,
+		     &number_of_items,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid shell item size value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( shell_item_size == 0 )
+		if( ( number_of_items > 0 )
+		 && ( internal_item_list->recycled_items_array == NULL ) )
 		{
-			byte_stream                   += 2;
-			byte_stream_size              -= 2;
-			internal_item_list->data_size += 2;
+			if( libcdata_array_initialize(
+			     &( internal_item_list->recycled_items_array ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create recycled items array.",
+				 function );
 
-			break;
+				return( -1 );
+			}
 		}
-		if( libfwsi_internal_item_initialize(
-		     &internal_shell_item,
-		     error ) != 1 )
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create shell item.",
-			 function );
+			if( libcdata_array_get_entry_by_index(
+			     internal_item_list->items_array,
+			     item_index,
+			     (intptr_t **) &internal_shell_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item: %d.",
+				 function,
+				 item_index );
 
-			goto on_error;
-		}
-		if( internal_shell_item == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: missing shell item.",
-			 function );
+				return( -1 );
+			}
+			if( internal_shell_item == NULL )
+			{
+				continue;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     internal_item_list->items_array,
+			     item_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set item: %d.",
+				 function,
+				 item_index );
 
-			goto on_error;
-		}
-		internal_shell_item->is_managed = 1;
+				return( -1 );
+			}
+			/* An item allocated as a single block cannot release its values
+			 * for reuse and is freed instead
+			 */
+			if( internal_shell_item->owns_arena != 0 )
+			{
+				if( libfwsi_internal_item_free(
+				     &internal_shell_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free item: %d.",
+					 function,
+					 item_index );
 
-		if( libfwsi_item_copy_from_byte_stream(
-		     (libfwsi_item_t *) internal_shell_item,
-		     byte_stream,
-		     byte_stream_size,
-		     ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy byte stream to shell item.",
-			 function );
+					return( -1 );
+				}
+				continue;
+			}
+			if( libfwsi_internal_item_clear(
+			     internal_shell_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear item: %d.",
+				 function,
+				 item_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     internal_item_list->recycled_items_array,
+			     &entry_index,
+			     (intptr_t *) internal_shell_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append item: %d to recycled items array.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			internal_shell_item = NULL;
 		}
-		byte_stream                   += shell_item_size;
-		byte_stream_size              -= shell_item_size;
-		internal_item_list->data_size += (size_t) shell_item_size;
+	}
+	if( libcdata_array_empty(
+	     internal_item_list->items_array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty items array.",
+		 function );
 
-		if( libcdata_array_append_entry(
-		     internal_item_list->items_array,
-		     &item_list_index,
-		     (intptr_t *) internal_shell_item,
+		return( -1 );
+	}
+	/* The arena of an item list that is managed by a batch is cleared by the batch
+	 */
+	if( ( internal_item_list->arena != NULL )
+	 && ( internal_item_list->is_managed == 0 ) )
+	{
+		if( libfwsi_arena_clear(
+		     internal_item_list->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append shell item: %d.",
-			 function,
-			 shell_item_index );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear arena.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_shell_item = NULL;
-
-		shell_item_index++;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
 	}
-#endif
-	internal_item_list->ascii_codepage = ascii_codepage;
+	internal_item_list->data_size      = 0;
+	internal_item_list->ascii_codepage = 0;
 
 	return( 1 );
 
@@ -377,16 +496,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the data size
+/* Retrieves the parse flags
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_data_size(
+int libfwsi_item_list_get_parse_flags(
      libfwsi_item_list_t *item_list,
-     size_t *data_size,
+     uint32_t *parse_flags,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_data_size";
+	static char *function                            = "libfwsi_item_list_get_parse_flags";
 
 	if( item_list == NULL )
 	{
@@ -401,32 +520,33 @@ int libfwsi_item_list_get_data_size(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( data_size == NULL )
+	if( parse_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 "%s: invalid parse flags.",
 		 function );
 
 		return( -1 );
 	}
-	*data_size = internal_item_list->data_size;
+	*parse_flags = internal_item_list->parse_flags;
 
 	return( 1 );
 }
 
-/* Retrieves the number of items
+/* Sets the parse flags
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_number_of_items(
+int libfwsi_item_list_set_parse_flags(
      libfwsi_item_list_t *item_list,
-     int *number_of_items,
+     uint32_t parse_flags,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_number_of_items";
+	static char *function                            = "libfwsi_item_list_set_parse_flags";
+	int number_of_items                              = 0;
 
 	if( item_list == NULL )
 	{
@@ -441,34 +561,87 @@ int libfwsi_item_list_get_number_of_items(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
+	if( ( parse_flags & ~( LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_USE_ARENA | LIBFWSI_PARSE_FLAG_BORROW_DATA | LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags: 0x%08" PRIx32 ".",
+		 function,
+		 parse_flags );
+
+		return( -1 );
+	}
+	if( internal_item_list->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid item list - managed by batch.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_item_list->items_array,
-	     number_of_items,
+	     &number_of_items,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to retrieve number of items.",
 		 function );
 
 		return( -1 );
 	}
+	if( number_of_items != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list - items already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( parse_flags & LIBFWSI_PARSE_FLAG_USE_ARENA ) == 0 )
+	 && ( internal_item_list->arena != NULL ) )
+	{
+		if( libfwsi_arena_free(
+		     &( internal_item_list->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_item_list->parse_flags = parse_flags;
+
 	return( 1 );
 }
 
-/* Retrieves a specific item
+/* Retrieves the decode types
  * Returns 1 if successful or -1 on error
  */
-int libfwsi_item_list_get_item(
+int libfwsi_item_list_get_decode_types(
      libfwsi_item_list_t *item_list,
-     int item_index,
-     libfwsi_item_t **item,
+     uint32_t *item_types,
+     uint64_t *extension_block_signatures,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_item";
+	static char *function                            = "libfwsi_item_list_get_decode_types";
 
 	if( item_list == NULL )
 	{
@@ -483,22 +656,2705 @@ int libfwsi_item_list_get_item(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_item_list->items_array,
-	     item_index,
-	     (intptr_t **) item,
-	     error ) != 1 )
+	if( item_types == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve list item: %d.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item types.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_block_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block signatures.",
+		 function );
+
+		return( -1 );
+	}
+	*item_types                 = internal_item_list->decode_item_types;
+	*extension_block_signatures = internal_item_list->decode_extension_block_signatures;
+
+	return( 1 );
+}
+
+/* Sets the decode types
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_set_decode_types(
+     libfwsi_item_list_t *item_list,
+     uint32_t item_types,
+     uint64_t extension_block_signatures,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_set_decode_types";
+	int number_of_items                              = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( internal_item_list->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid item list - managed by batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list - items already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list->decode_item_types                 = item_types;
+	internal_item_list->decode_extension_block_signatures = extension_block_signatures;
+
+	return( 1 );
+}
+
+/* Retrieves an item to read into
+ * A previously cleared item is reused if available otherwise a new item is created
+ * The data size of the item is used to size an item that is allocated as a single block
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_recycled_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     libfwsi_internal_item_t **internal_item,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_shell_item = NULL;
+	static char *function                        = "libfwsi_item_list_get_recycled_item";
+	int number_of_recycled_items                 = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_list->arena == NULL )
+	 && ( ( internal_item_list->parse_flags & LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION ) == 0 )
+	 && ( internal_item_list->recycled_items_array != NULL ) )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_item_list->recycled_items_array,
+		     &number_of_recycled_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of recycled items.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_recycled_items > 0 )
+	{
+		number_of_recycled_items--;
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_item_list->recycled_items_array,
+		     number_of_recycled_items,
+		     (intptr_t **) &internal_shell_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recycled item: %d.",
+			 function,
+			 number_of_recycled_items );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_item_list->recycled_items_array,
+		     number_of_recycled_items,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recycled item: %d.",
+			 function,
+			 number_of_recycled_items );
+
+			return( -1 );
+		}
+		if( libcdata_array_resize(
+		     internal_item_list->recycled_items_array,
+		     number_of_recycled_items,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize recycled items array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_item_list->arena == NULL )
+	      && ( ( internal_item_list->parse_flags & LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION ) != 0 ) )
+	{
+		if( libfwsi_internal_item_initialize_single_allocation(
+		     &internal_shell_item,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libfwsi_internal_item_initialize(
+	          &internal_shell_item,
+	          internal_item_list->arena,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_shell_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing item.",
+		 function );
+
+		goto on_error;
+	}
+	internal_shell_item->is_managed = 1;
+
+	*internal_item = internal_shell_item;
+
+	return( 1 );
+
+on_error:
+	if( internal_shell_item != NULL )
+	{
+		libfwsi_internal_item_free(
+		 &internal_shell_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies a shell item list from a byte stream
+ * The item list must not contain items, both when the items are read directly and
+ * when LIBFWSI_PARSE_FLAG_LAZY is set, use libfwsi_item_list_clear to reuse an item list
+ * On failure the item list is left empty so that it can be reused without clearing it
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_copy_from_byte_stream(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_copy_from_byte_stream";
+	size_t parse_error_offset                        = 0;
+	int parse_error                                  = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( libfwsi_internal_item_list_copy_from_byte_stream(
+	     internal_item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     &parse_error,
+	     &parse_error_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item list from byte stream at offset: %" PRIzu ".",
 		 function,
-		 item_index );
+		 parse_error_offset );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
+/* Copies a shell item list from a byte stream without constructing errors
+ * On failure the parse error is set to a LIBFWSI_PARSE_ERROR value and the parse error offset
+ * to the offset of the byte stream or item at which the failure occurred
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_try_copy_from_byte_stream(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int *parse_error,
+     size_t *parse_error_offset )
+{
+	if( ( parse_error == NULL )
+	 || ( parse_error_offset == NULL ) )
+	{
+		return( -1 );
+	}
+	if( item_list == NULL )
+	{
+		*parse_error        = LIBFWSI_PARSE_ERROR_INVALID_ARGUMENT;
+		*parse_error_offset = 0;
+
+		return( -1 );
+	}
+	return( libfwsi_internal_item_list_copy_from_byte_stream(
+	         (libfwsi_internal_item_list_t *) item_list,
+	         byte_stream,
+	         byte_stream_size,
+	         ascii_codepage,
+	         parse_error,
+	         parse_error_offset,
+	         NULL ) );
+}
+
+/* Copies the last items of a shell item list from a byte stream
+ * The preceding items are skipped using their size values and are not read
+ * The data size of the item list only covers the copied items and the terminator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_copy_tail_from_byte_stream(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int number_of_tail_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_copy_tail_from_byte_stream";
+	size_t byte_stream_offset                        = 0;
+	size_t parse_error_offset                        = 0;
+	uint16_t shell_item_size                         = 0;
+	int number_of_items                              = 0;
+	int parse_error                                  = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tail_items <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of tail items value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_items = libfwsi_item_list_count_items(
+	                   byte_stream,
+	                   byte_stream_size );
+
+	/* Skip the items that precede the tail items, the size values
+	 * of these items were checked by libfwsi_item_list_count_items
+	 */
+	while( number_of_items > number_of_tail_items )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		byte_stream_offset += shell_item_size;
+
+		number_of_items--;
+	}
+	if( libfwsi_internal_item_list_copy_from_byte_stream(
+	     internal_item_list,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     byte_stream_size - byte_stream_offset,
+	     ascii_codepage,
+	     &parse_error,
+	     &parse_error_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item list from byte stream at offset: %" PRIzu ".",
+		 function,
+		 byte_stream_offset + parse_error_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a shell item list from a byte stream
+ * The parse error and parse error offset are set on failure, the error is optional
+ * and is not constructed when NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_copy_from_byte_stream(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_shell_item = NULL;
+	static char *function                        = "libfwsi_internal_item_list_copy_from_byte_stream";
+	size_t byte_stream_offset                    = 0;
+	uint16_t shell_item_size                     = 0;
+	int item_list_index                          = 0;
+	int number_of_items                          = 0;
+	int number_of_reserved_items                 = 0;
+	int shell_item_index                         = 0;
+
+	if( ( parse_error == NULL )
+	 || ( parse_error_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse error.",
+		 function );
+
+		return( -1 );
+	}
+	*parse_error        = LIBFWSI_PARSE_ERROR_INVALID_ARGUMENT;
+	*parse_error_offset = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		*parse_error = LIBFWSI_PARSE_ERROR_BYTE_STREAM_TOO_SMALL;
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*parse_error = LIBFWSI_PARSE_ERROR_RUNTIME;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	/* The items of both the eager and the lazy parse modes are read into an empty item list
+	 * use libfwsi_item_list_clear to reuse an item list
+	 */
+	if( number_of_items != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list - items already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A list that only contains a terminator is not reset by the check above
+	 */
+	internal_item_list->data_size = 0;
+
+	if( ( ( internal_item_list->parse_flags & LIBFWSI_PARSE_FLAG_USE_ARENA ) != 0 )
+	 && ( internal_item_list->arena == NULL ) )
+	{
+		if( libfwsi_arena_initialize(
+		     &( internal_item_list->arena ),
+		     LIBFWSI_ITEM_LIST_ARENA_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_item_list->parse_flags & LIBFWSI_PARSE_FLAG_LAZY ) != 0 )
+	{
+		if( libfwsi_item_list_read_item_offsets(
+		     internal_item_list,
+		     byte_stream,
+		     byte_stream_size,
+		     parse_error,
+		     parse_error_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read item offsets.",
+			 function );
+
+			return( -1 );
+		}
+		internal_item_list->ascii_codepage = ascii_codepage;
+
+		*parse_error = LIBFWSI_PARSE_ERROR_NONE;
+
+		return( 1 );
+	}
+	/* Determine the number of items up front so that
+	 * the items array is resized only once
+	 */
+	number_of_reserved_items = libfwsi_item_list_count_items(
+	                            byte_stream,
+	                            byte_stream_size );
+
+	if( number_of_reserved_items > ( INT_MAX - number_of_items ) )
+	{
+		number_of_reserved_items = INT_MAX - number_of_items;
+	}
+	if( number_of_reserved_items > 0 )
+	{
+		if( libcdata_array_resize(
+		     internal_item_list->items_array,
+		     number_of_items + number_of_reserved_items,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize items array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 shell_item_index );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS;
+			*parse_error_offset = byte_stream_offset;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
+			 function,
+			 shell_item_index,
+			 shell_item_size );
+		}
+#endif
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 shell_item_index );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS;
+			*parse_error_offset = byte_stream_offset;
+
+			goto on_error;
+		}
+		if( shell_item_size == 0 )
+		{
+			byte_stream_offset            += 2;
+			internal_item_list->data_size += 2;
+
+			break;
+		}
+		if( libfwsi_item_list_get_recycled_item(
+		     internal_item_list,
+		     &internal_shell_item,
+		     (size_t) shell_item_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shell item.",
+			 function );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_RUNTIME;
+			*parse_error_offset = byte_stream_offset;
+
+			goto on_error;
+		}
+		if( ( internal_item_list->parse_flags & LIBFWSI_PARSE_FLAG_BORROW_DATA ) != 0 )
+		{
+			internal_shell_item->borrow_data = 1;
+		}
+		internal_shell_item->skip_item_types                 = ~( internal_item_list->decode_item_types );
+		internal_shell_item->skip_extension_block_signatures = ~( internal_item_list->decode_extension_block_signatures );
+
+		if( libfwsi_item_copy_from_byte_stream(
+		     (libfwsi_item_t *) internal_shell_item,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to shell item.",
+			 function );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_ITEM_DATA_INVALID;
+			*parse_error_offset = byte_stream_offset;
+
+			goto on_error;
+		}
+		byte_stream_offset            += shell_item_size;
+		internal_item_list->data_size += (size_t) shell_item_size;
+
+		if( shell_item_index < number_of_reserved_items )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_item_list->items_array,
+			     number_of_items + shell_item_index,
+			     (intptr_t *) internal_shell_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				*parse_error        = LIBFWSI_PARSE_ERROR_RUNTIME;
+				*parse_error_offset = byte_stream_offset;
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libcdata_array_append_entry(
+			     internal_item_list->items_array,
+			     &item_list_index,
+			     (intptr_t *) internal_shell_item,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				*parse_error        = LIBFWSI_PARSE_ERROR_RUNTIME;
+				*parse_error_offset = byte_stream_offset;
+
+				goto on_error;
+			}
+		}
+		internal_shell_item = NULL;
+
+		shell_item_index++;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	internal_item_list->ascii_codepage = ascii_codepage;
+
+	*parse_error = LIBFWSI_PARSE_ERROR_NONE;
+
+	return( 1 );
+
+on_error:
+	if( internal_shell_item != NULL )
+	{
+		libfwsi_internal_item_free(
+		 &internal_shell_item,
+		 NULL );
+	}
+	/* Recycle the items read before the failure and remove the reserved entries
+	 * so that the item list is empty again and can be reused without clearing it
+	 */
+	libfwsi_item_list_clear(
+	 (libfwsi_item_list_t *) internal_item_list,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the item offsets from the size values of the items in a byte stream
+ * The byte stream is copied so that the items can be read on demand
+ * The item list is expected to be empty, which is checked by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_read_item_offsets(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_item_list_read_item_offsets";
+	void *reallocation        = NULL;
+	size_t byte_stream_offset = 0;
+	size_t data_size          = 0;
+	uint16_t shell_item_size  = 0;
+	int number_of_items       = 0;
+	int shell_item_index      = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_error == NULL )
+	 || ( parse_error_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse error.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 2 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the number of items and the size of the list
+	 */
+	while( byte_stream_offset < byte_stream_size )
+	{
+		/* A trailing byte that cannot contain a size value is rejected
+		 * as when the items are read directly
+		 */
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 number_of_items );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS;
+			*parse_error_offset = byte_stream_offset;
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( shell_item_size == 0 )
+		{
+			byte_stream_offset += 2;
+
+			break;
+		}
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 number_of_items );
+
+			*parse_error        = LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS;
+			*parse_error_offset = byte_stream_offset;
+
+			return( -1 );
+		}
+		if( number_of_items == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of items value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += shell_item_size;
+
+		number_of_items++;
+	}
+	data_size = byte_stream_offset;
+
+	if( number_of_items > 0 )
+	{
+		/* The item offsets and data are retained when the item list is cleared
+		 * and only reallocated when they are too small
+		 */
+		if( number_of_items > internal_item_list->number_of_allocated_item_offsets )
+		{
+			reallocation = memory_reallocate(
+			                internal_item_list->item_offsets,
+			                sizeof( size_t ) * number_of_items );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize item offsets.",
+				 function );
+
+				return( -1 );
+			}
+			internal_item_list->item_offsets                     = (size_t *) reallocation;
+			internal_item_list->number_of_allocated_item_offsets = number_of_items;
+		}
+		if( data_size > internal_item_list->allocated_data_size )
+		{
+			reallocation = memory_reallocate(
+			                internal_item_list->data,
+			                sizeof( uint8_t ) * data_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_item_list->data                = (uint8_t *) reallocation;
+			internal_item_list->allocated_data_size = data_size;
+		}
+		if( memory_copy(
+		     internal_item_list->data,
+		     byte_stream,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		/* The entries of the items array are set when the items are read
+		 */
+		if( libcdata_array_resize(
+		     internal_item_list->items_array,
+		     number_of_items,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize items array.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset = 0;
+
+		for( shell_item_index = 0;
+		     shell_item_index < number_of_items;
+		     shell_item_index++ )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( byte_stream[ byte_stream_offset ] ),
+			 shell_item_size );
+
+			internal_item_list->item_offsets[ shell_item_index ] = byte_stream_offset;
+
+			byte_stream_offset += shell_item_size;
+		}
+	}
+	internal_item_list->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Validates a shell item list in a byte stream without creating the items
+ * Checks the size values of the items, that every item contains at least
+ * its size and class type indicator and the extension blocks of file entry items
+ * The list ends at a terminator or at the end of the byte stream
+ * This function does not allocate memory or set errors, which makes it suitable
+ * to determine whether libfwsi_item_list_copy_from_byte_stream should be called
+ * Returns 1 if the shell item list is valid, 0 if not or -1 on error
+ */
+int libfwsi_item_list_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *list_size,
+     int *number_of_items )
+{
+	size_t byte_stream_offset = 0;
+	uint16_t shell_item_size  = 0;
+	int shell_item_index      = 0;
+
+	if( ( byte_stream == NULL )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX )
+	 || ( list_size == NULL )
+	 || ( number_of_items == NULL ) )
+	{
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		return( 0 );
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( shell_item_size == 0 )
+		{
+			byte_stream_offset += 2;
+
+			break;
+		}
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			return( 0 );
+		}
+		if( libfwsi_item_validate(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     shell_item_size ) != 1 )
+		{
+			return( 0 );
+		}
+		if( shell_item_index == INT_MAX )
+		{
+			return( 0 );
+		}
+		byte_stream_offset += shell_item_size;
+
+		shell_item_index++;
+	}
+	*list_size       = byte_stream_offset;
+	*number_of_items = shell_item_index;
+
+	return( 1 );
+}
+
+/* Determines the number of items in a shell item list in a byte stream from the item size values
+ * The count ends at the terminator or at an item size value that is out of bounds
+ * This function does not allocate memory or set errors
+ * Returns the number of items
+ */
+int libfwsi_item_list_count_items(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+	uint16_t shell_item_size  = 0;
+	int number_of_items       = 0;
+
+	if( byte_stream == NULL )
+	{
+		return( 0 );
+	}
+	while( ( byte_stream_size - byte_stream_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( ( shell_item_size == 0 )
+		 || ( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) ) )
+		{
+			break;
+		}
+		if( number_of_items == INT_MAX )
+		{
+			break;
+		}
+		byte_stream_offset += shell_item_size;
+
+		number_of_items++;
+	}
+	return( number_of_items );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_data_size(
+     libfwsi_item_list_t *item_list,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_data_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_item_list->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_number_of_items(
+     libfwsi_item_list_t *item_list,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_number_of_items";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * If the items are read on demand the item is read when it is first retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_internal_item_t *internal_shell_item     = NULL;
+	static char *function                            = "libfwsi_item_list_get_item";
+	size_t item_offset                               = 0;
+	uint16_t shell_item_size                         = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_item_list->items_array,
+	     item_index,
+	     (intptr_t **) &internal_shell_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( ( internal_shell_item == NULL )
+	 && ( internal_item_list->item_offsets != NULL ) )
+	{
+		item_offset = internal_item_list->item_offsets[ item_index ];
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( internal_item_list->data[ item_offset ] ),
+		 shell_item_size );
+
+		if( libfwsi_item_list_get_recycled_item(
+		     internal_item_list,
+		     &internal_shell_item,
+		     (size_t) shell_item_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shell item.",
+			 function );
+
+			goto on_error;
+		}
+		/* The data of the item list is owned by the item list so it can always be referenced
+		 */
+		internal_shell_item->borrow_data                     = 1;
+		internal_shell_item->skip_item_types                 = ~( internal_item_list->decode_item_types );
+		internal_shell_item->skip_extension_block_signatures = ~( internal_item_list->decode_extension_block_signatures );
+
+		if( libfwsi_item_copy_from_byte_stream(
+		     (libfwsi_item_t *) internal_shell_item,
+		     &( internal_item_list->data[ item_offset ] ),
+		     internal_item_list->data_size - item_offset,
+		     internal_item_list->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to shell item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_item_list->items_array,
+		     item_index,
+		     (intptr_t *) internal_shell_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set shell item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+	}
+	*item = (libfwsi_item_t *) internal_shell_item;
+
+	return( 1 );
+
+on_error:
+	if( internal_shell_item != NULL )
+	{
+		libfwsi_internal_item_free(
+		 &internal_shell_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the last character of a path segment string
+ * Only 7-bit ASCII characters are determined, other characters are set to 0xffff
+ * Returns 1 if successful or 0 if the path segment string is empty
+ */
+int libfwsi_item_list_get_path_segment_last_character(
+     const uint8_t *segment_string,
+     size_t segment_string_size,
+     int segment_string_type,
+     int ascii_codepage,
+     uint16_t *last_character )
+{
+	size_t segment_string_index = 0;
+	uint16_t value_16bit        = 0;
+
+	if( ( segment_string == NULL )
+	 || ( last_character == NULL ) )
+	{
+		return( 0 );
+	}
+	if( segment_string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+	{
+		segment_string_size &= ~( (size_t) 1 );
+
+		for( segment_string_index = 0;
+		     segment_string_index < segment_string_size;
+		     segment_string_index += 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( segment_string[ segment_string_index ] ),
+			 value_16bit );
+
+			if( value_16bit == 0 )
+			{
+				break;
+			}
+		}
+		if( segment_string_index == 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( segment_string[ segment_string_index - 2 ] ),
+		 value_16bit );
+
+		if( value_16bit >= 0x80 )
+		{
+			value_16bit = 0xffff;
+		}
+	}
+	else
+	{
+		for( segment_string_index = 0;
+		     segment_string_index < segment_string_size;
+		     segment_string_index++ )
+		{
+			if( segment_string[ segment_string_index ] == 0 )
+			{
+				break;
+			}
+		}
+		if( segment_string_index == 0 )
+		{
+			return( 0 );
+		}
+		value_16bit = segment_string[ segment_string_index - 1 ];
+
+		if( value_16bit >= 0x80 )
+		{
+			value_16bit = 0xffff;
+		}
+		/* In the double byte codepages the second byte of a character can be a 7-bit ASCII value
+		 */
+		else if( ( segment_string_index >= 2 )
+		      && ( segment_string[ segment_string_index - 2 ] >= 0x80 )
+		      && ( ( ascii_codepage == LIBFWSI_CODEPAGE_WINDOWS_932 )
+		        || ( ascii_codepage == LIBFWSI_CODEPAGE_WINDOWS_936 )
+		        || ( ascii_codepage == LIBFWSI_CODEPAGE_WINDOWS_949 )
+		        || ( ascii_codepage == LIBFWSI_CODEPAGE_WINDOWS_950 ) ) )
+		{
+			value_16bit = 0xffff;
+		}
+	}
+	*last_character = value_16bit;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of the items
+ * The path is built from the path segments of the items, items without a path segment are skipped
+ * The path separator is not added after a path segment that already ends with it, such as a volume name
+ * The size of the path, including the end of string character, is determined if utf8_string is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t path_separator,
+     size_t *utf8_path_size,
+     libcerror_error_t **error )
+{
+	libfwsi_item_t *item           = NULL;
+	const uint8_t *segment_string  = NULL;
+	static char *function          = "libfwsi_internal_item_list_get_utf8_path";
+	size_t path_size               = 1;
+	size_t segment_string_size     = 0;
+	size_t segment_utf8_size       = 0;
+	size_t utf8_string_index       = 0;
+	uint16_t last_character        = 0;
+	uint8_t ends_with_separator    = 1;
+	int ascii_codepage             = 0;
+	int item_index                 = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+	int segment_string_type        = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libfwsi_item_list_get_item(
+		     (libfwsi_item_list_t *) internal_item_list,
+		     item_index,
+		     &item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		result = libfwsi_internal_item_get_path_segment(
+		          (libfwsi_internal_item_t *) item,
+		          &segment_string,
+		          &segment_string_size,
+		          &segment_string_type,
+		          &ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_item_list_get_path_segment_last_character(
+		     segment_string,
+		     segment_string_size,
+		     segment_string_type,
+		     ascii_codepage,
+		     &last_character ) != 1 )
+		{
+			continue;
+		}
+		if( ends_with_separator == 0 )
+		{
+			if( utf8_string != NULL )
+			{
+				if( utf8_string_index >= utf8_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string size too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf8_string[ utf8_string_index++ ] = path_separator;
+			}
+			path_size += 1;
+		}
+		if( utf8_string != NULL )
+		{
+			if( segment_string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+			{
+				result = libfwsi_string_with_index_copy_utf8_from_utf16_stream(
+				          utf8_string,
+				          utf8_string_size,
+				          &utf8_string_index,
+				          segment_string,
+				          segment_string_size & ~( (size_t) 1 ),
+				          error );
+			}
+			else
+			{
+				result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+				          utf8_string,
+				          utf8_string_size,
+				          &utf8_string_index,
+				          segment_string,
+				          segment_string_size,
+				          ascii_codepage,
+				          error );
+			}
+		}
+		else
+		{
+			if( segment_string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+			{
+				result = libfwsi_string_get_utf8_size_from_utf16_stream(
+				          segment_string,
+				          segment_string_size & ~( (size_t) 1 ),
+				          &segment_utf8_size,
+				          error );
+			}
+			else
+			{
+				result = libfwsi_string_get_utf8_size_from_byte_stream(
+				          segment_string,
+				          segment_string_size,
+				          ascii_codepage,
+				          &segment_utf8_size,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UTF-8 path segment of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( utf8_string != NULL )
+		{
+			/* Overwrite the end of string character with the next path segment
+			 */
+			utf8_string_index -= 1;
+		}
+		else
+		{
+			path_size += segment_utf8_size - 1;
+		}
+		ends_with_separator = (uint8_t) ( last_character == (uint16_t) path_separator );
+	}
+	if( utf8_string != NULL )
+	{
+		if( utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ utf8_string_index++ ] = 0;
+
+		path_size = utf8_string_index;
+	}
+	*utf8_path_size = path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded path of the items
+ * The path is built from the path segments of the items, items without a path segment are skipped
+ * The path separator is not added after a path segment that already ends with it, such as a volume name
+ * The size of the path, including the end of string character, is determined if utf16_string is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t path_separator,
+     size_t *utf16_path_size,
+     libcerror_error_t **error )
+{
+	libfwsi_item_t *item           = NULL;
+	const uint8_t *segment_string  = NULL;
+	static char *function          = "libfwsi_internal_item_list_get_utf16_path";
+	size_t path_size               = 1;
+	size_t segment_string_size     = 0;
+	size_t segment_utf16_size      = 0;
+	size_t utf16_string_index      = 0;
+	uint16_t last_character        = 0;
+	uint8_t ends_with_separator    = 1;
+	int ascii_codepage             = 0;
+	int item_index                 = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+	int segment_string_type        = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_item_list->items_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libfwsi_item_list_get_item(
+		     (libfwsi_item_list_t *) internal_item_list,
+		     item_index,
+		     &item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		result = libfwsi_internal_item_get_path_segment(
+		          (libfwsi_internal_item_t *) item,
+		          &segment_string,
+		          &segment_string_size,
+		          &segment_string_type,
+		          &ascii_codepage,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_item_list_get_path_segment_last_character(
+		     segment_string,
+		     segment_string_size,
+		     segment_string_type,
+		     ascii_codepage,
+		     &last_character ) != 1 )
+		{
+			continue;
+		}
+		if( ends_with_separator == 0 )
+		{
+			if( utf16_string != NULL )
+			{
+				if( utf16_string_index >= utf16_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-16 string size too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf16_string[ utf16_string_index++ ] = path_separator;
+			}
+			path_size += 1;
+		}
+		if( utf16_string != NULL )
+		{
+			if( segment_string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+			{
+				result = libuna_utf16_string_with_index_copy_from_utf16_stream(
+				          utf16_string,
+				          utf16_string_size,
+				          &utf16_string_index,
+				          segment_string,
+				          segment_string_size & ~( (size_t) 1 ),
+				          LIBUNA_ENDIAN_LITTLE,
+				          error );
+			}
+			else
+			{
+				result = libuna_utf16_string_with_index_copy_from_byte_stream(
+				          utf16_string,
+				          utf16_string_size,
+				          &utf16_string_index,
+				          segment_string,
+				          segment_string_size,
+				          ascii_codepage,
+				          error );
+			}
+		}
+		else
+		{
+			if( segment_string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+			{
+				result = libuna_utf16_string_size_from_utf16_stream(
+				          segment_string,
+				          segment_string_size & ~( (size_t) 1 ),
+				          LIBUNA_ENDIAN_LITTLE,
+				          &segment_utf16_size,
+				          error );
+			}
+			else
+			{
+				result = libuna_utf16_string_size_from_byte_stream(
+				          segment_string,
+				          segment_string_size,
+				          ascii_codepage,
+				          &segment_utf16_size,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UTF-16 path segment of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( utf16_string != NULL )
+		{
+			/* Overwrite the end of string character with the next path segment
+			 */
+			utf16_string_index -= 1;
+		}
+		else
+		{
+			path_size += segment_utf16_size - 1;
+		}
+		ends_with_separator = (uint8_t) ( last_character == path_separator );
+	}
+	if( utf16_string != NULL )
+	{
+		if( utf16_string_index >= utf16_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ utf16_string_index++ ] = 0;
+
+		path_size = utf16_string_index;
+	}
+	*utf16_path_size = path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of the items
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf8_path_size(
+     libfwsi_item_list_t *item_list,
+     size_t *utf8_string_size,
+     uint8_t path_separator,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_utf8_path_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_separator == 0 )
+	 || ( path_separator >= 0x80 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf8_path(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     NULL,
+	     0,
+	     path_separator,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of the items
+ * The path consists of the names of the items separated by the path separator
+ * The long name of a file entry is used when available and root folder, volume
+ * and known folder identifiers are resolved to their names
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf8_path(
+     libfwsi_item_list_t *item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t path_separator,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_utf8_path";
+	size_t utf8_path_size = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_separator == 0 )
+	 || ( path_separator >= 0x80 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf8_path(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     utf8_string,
+	     utf8_string_size,
+	     path_separator,
+	     &utf8_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded path of the items
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf16_path_size(
+     libfwsi_item_list_t *item_list,
+     size_t *utf16_string_size,
+     uint16_t path_separator,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_get_utf16_path_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_separator == 0 )
+	 || ( path_separator >= 0x80 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf16_path(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     NULL,
+	     0,
+	     path_separator,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded path of the items
+ * The path consists of the names of the items separated by the path separator
+ * The long name of a file entry is used when available and root folder, volume
+ * and known folder identifiers are resolved to their names
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_utf16_path(
+     libfwsi_item_list_t *item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t path_separator,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_item_list_get_utf16_path";
+	size_t utf16_path_size = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_separator == 0 )
+	 || ( path_separator >= 0x80 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_utf16_path(
+	     (libfwsi_internal_item_list_t *) item_list,
+	     utf16_string,
+	     utf16_string_size,
+	     path_separator,
+	     &utf16_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Visits the items of an item list in a byte stream
+ * The item callback is called for every item and the extension block callback
+ * for every extension block of an item, either callback can be NULL
+ * The item and extension block passed to the callbacks are only valid during the callback
+ * and the item list is not retained after the function returns
+ * A callback returns 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
+ */
+int libfwsi_item_list_visit_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwsi_arena_t *arena = NULL;
+	static char *function  = "libfwsi_item_list_visit_byte_stream";
+	int result             = 0;
+
+	if( libfwsi_arena_initialize(
+	     &arena,
+	     LIBFWSI_ITEM_LIST_ARENA_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_internal_item_list_visit_byte_stream(
+	          arena,
+	          byte_stream,
+	          byte_stream_size,
+	          ascii_codepage,
+	          item_callback,
+	          extension_block_callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwsi_arena_free(
+	     &arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( arena != NULL )
+	{
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Visits the items of an item list in a byte stream
+ * The values of the items are allocated from an arena that is retained by the item list
+ * and reused by subsequent visits, the items of the item list itself are not changed
+ * The callbacks are called as in libfwsi_item_list_visit_byte_stream
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
+ */
+int libfwsi_item_list_visit_byte_stream_with_item_list(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_visit_byte_stream_with_item_list";
+	int result                                       = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( internal_item_list->visit_arena == NULL )
+	{
+		if( libfwsi_arena_initialize(
+		     &( internal_item_list->visit_arena ),
+		     LIBFWSI_ITEM_LIST_ARENA_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create visit arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libfwsi_internal_item_list_visit_byte_stream(
+	          internal_item_list->visit_arena,
+	          byte_stream,
+	          byte_stream_size,
+	          ascii_codepage,
+	          item_callback,
+	          extension_block_callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit items.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Visits the items of an item list in a byte stream
+ * The values of the shell item are allocated from the arena, which is cleared for every item
+ * so that visiting does not allocate memory once the arena blocks are in place
+ * Returns 1 if successful, 0 if stopped by a callback or -1 on error
+ */
+int libfwsi_internal_item_list_visit_byte_stream(
+     libfwsi_arena_t *arena,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	libfwsi_internal_item_t internal_shell_item;
+
+	static char *function                                        = "libfwsi_internal_item_list_visit_byte_stream";
+	size_t byte_stream_offset                                    = 0;
+	size_t extension_block_offset                                = 0;
+	uint16_t shell_item_size                                     = 0;
+	int extension_block_index                                    = 0;
+	int result                                                   = 1;
+	int shell_item_index                                         = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &internal_shell_item,
+	     0,
+	     sizeof( libfwsi_internal_item_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shell item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_shell_item.arena = arena;
+
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 shell_item_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item: %d size value out of bounds.",
+			 function,
+			 shell_item_index );
+
+			goto on_error;
+		}
+		if( shell_item_size == 0 )
+		{
+			break;
+		}
+		if( libfwsi_internal_item_clear(
+		     &internal_shell_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear shell item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwsi_arena_clear(
+		     arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear arena.",
+			 function );
+
+			goto on_error;
+		}
+		internal_shell_item.borrow_data = 1;
+
+		if( libfwsi_item_copy_from_byte_stream(
+		     (libfwsi_item_t *) &internal_shell_item,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			goto on_error;
+		}
+		if( item_callback != NULL )
+		{
+			result = item_callback(
+			          (libfwsi_item_t *) &internal_shell_item,
+			          shell_item_index,
+			          byte_stream_offset,
+			          &( byte_stream[ byte_stream_offset ] ),
+			          (size_t) shell_item_size,
+			          callback_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: item callback failed for shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( extension_block_callback != NULL )
+		{
+			extension_block_offset = byte_stream_offset + internal_shell_item.extension_blocks_offset;
+
+			for( extension_block_index = 0;
+			     extension_block_index < internal_shell_item.number_of_extension_blocks;
+			     extension_block_index++ )
+			{
+				internal_extension_block = internal_shell_item.extension_blocks[ extension_block_index ];
+
+				result = extension_block_callback(
+				          (libfwsi_extension_block_t *) internal_extension_block,
+				          shell_item_index,
+				          extension_block_index,
+				          extension_block_offset,
+				          &( byte_stream[ extension_block_offset ] ),
+				          (size_t) internal_extension_block->data_size,
+				          callback_data );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				extension_block_offset += internal_extension_block->data_size;
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: extension block callback failed for shell item: %d extension block: %d.",
+				 function,
+				 shell_item_index,
+				 extension_block_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		byte_stream_offset += shell_item_size;
+
+		shell_item_index++;
+	}
+	return( result );
+
+on_error:
+	return( -1 );
+}
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_extern.h"
+#include "libfwsi_item.h"
 #include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_types.h"
@@ -34,6 +36,10 @@
 extern "C" {
 #endif
 
+/* The size of the blocks of the item list arena
+ */
+#define LIBFWSI_ITEM_LIST_ARENA_BLOCK_SIZE	4096
+
 typedef struct libfwsi_internal_item_list libfwsi_internal_item_list_t;
 
 struct libfwsi_internal_item_list
@@ -49,6 +55,52 @@ struct libfwsi_internal_item_list
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The parse flags
+	 */
+	uint32_t parse_flags;
+
+	/* The item types of which the values are decoded
+	 */
+	uint32_t decode_item_types;
+
+	/* The extension block signatures of which the values are decoded
+	 */
+	uint64_t decode_extension_block_signatures;
+
+	/* The data, used when the items are read on demand
+	 */
+	uint8_t *data;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The item offsets, used when the items are read on demand
+	 */
+	size_t *item_offsets;
+
+	/* The number of allocated item offsets
+	 */
+	int number_of_allocated_item_offsets;
+
+	/* The recycled items array, contains cleared items that can be reused
+	 */
+	libcdata_array_t *recycled_items_array;
+
+	/* The arena the items are allocated from
+	 */
+	libfwsi_arena_t *arena;
+
+	/* Value to indicate the item list is managed by a batch
+	 * which owns the item list and its arena
+	 */
+	uint8_t is_managed;
+
+	/* The arena of the shell item used when visiting a byte stream
+	 * which is reused by subsequent visits
+	 */
+	libfwsi_arena_t *visit_arena;
 };
 
 LIBFWSI_EXTERN \
@@ -61,6 +113,15 @@ int libfwsi_item_list_free(
      libfwsi_item_list_t **item_list,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_list_free(
+     libfwsi_internal_item_list_t **internal_item_list,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_clear(
+     libfwsi_item_list_t *item_list,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_copy_from_byte_stream(
      libfwsi_item_list_t *item_list,
@@ -69,6 +130,84 @@ int libfwsi_item_list_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_try_copy_from_byte_stream(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int *parse_error,
+     size_t *parse_error_offset );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_copy_tail_from_byte_stream(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int number_of_tail_items,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_copy_from_byte_stream(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_parse_flags(
+     libfwsi_item_list_t *item_list,
+     uint32_t *parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_set_parse_flags(
+     libfwsi_item_list_t *item_list,
+     uint32_t parse_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_decode_types(
+     libfwsi_item_list_t *item_list,
+     uint32_t *item_types,
+     uint64_t *extension_block_signatures,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_set_decode_types(
+     libfwsi_item_list_t *item_list,
+     uint32_t item_types,
+     uint64_t extension_block_signatures,
+     libcerror_error_t **error );
+
+int libfwsi_item_list_get_recycled_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     libfwsi_internal_item_t **internal_item,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwsi_item_list_read_item_offsets(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int *parse_error,
+     size_t *parse_error_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *list_size,
+     int *number_of_items );
+
+int libfwsi_item_list_count_items(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_data_size(
      libfwsi_item_list_t *item_list,
@@ -88,6 +227,129 @@ int libfwsi_item_list_get_item(
      libfwsi_item_t **item,
      libcerror_error_t **error );
 
+int libfwsi_item_list_get_path_segment_last_character(
+     const uint8_t *segment_string,
+     size_t segment_string_size,
+     int segment_string_type,
+     int ascii_codepage,
+     uint16_t *last_character );
+
+int libfwsi_internal_item_list_get_utf8_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t path_separator,
+     size_t *utf8_path_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_get_utf16_path(
+     libfwsi_internal_item_list_t *internal_item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t path_separator,
+     size_t *utf16_path_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf8_path_size(
+     libfwsi_item_list_t *item_list,
+     size_t *utf8_string_size,
+     uint8_t path_separator,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf8_path(
+     libfwsi_item_list_t *item_list,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t path_separator,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf16_path_size(
+     libfwsi_item_list_t *item_list,
+     size_t *utf16_string_size,
+     uint16_t path_separator,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_utf16_path(
+     libfwsi_item_list_t *item_list,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t path_separator,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_visit_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_visit_byte_stream_with_item_list(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_visit_byte_stream(
+     libfwsi_arena_t *arena,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*item_callback)(
+            libfwsi_item_t *item,
+            int item_index,
+            size_t item_offset,
+            const uint8_t *item_data,
+            size_t item_data_size,
+            void *callback_data ),
+     int (*extension_block_callback)(
+            libfwsi_extension_block_t *extension_block,
+            int item_index,
+            int extension_block_index,
+            size_t extension_block_offset,
+            const uint8_t *extension_block_data,
+            size_t extension_block_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -29,6 +29,7 @@
 #include "libfwsi_libuna.h"
 #include "libfwsi_network_location.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_string.h"
 
 /* Retrieves the size of the UTF-8 formatted location
  * Returns 1 if successful or -1 on error
@@ -79,7 +80,7 @@ int libfwsi_network_location_get_utf8_location_size(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_get_utf8_size_from_byte_stream(
 	     network_location_values->location,
 	     network_location_values->location_size,
 	     network_location_values->ascii_codepage,
@@ -148,7 +149,7 @@ int libfwsi_network_location_get_utf8_location(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_copy_utf8_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->location,
@@ -168,6 +169,195 @@ int libfwsi_network_location_get_utf8_location(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted location and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_network_location_get_utf8_location_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_location_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_utf8_location_and_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_location_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 location size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     network_location_values->location,
+	     network_location_values->location_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_location_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_location_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted location from the string cache of the item
+ * The UTF-8 string is converted when first retrieved and remains valid until the item is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_location(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_cached_utf8_location";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_LOCATION,
+	     network_location_values->location,
+	     network_location_values->location_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted location
  * Returns 1 if successful or -1 on error
  */
@@ -360,7 +550,7 @@ int libfwsi_network_location_get_utf8_description_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_get_utf8_size_from_byte_stream(
 	     network_location_values->description,
 	     network_location_values->description_size,
 	     network_location_values->ascii_codepage,
@@ -434,7 +624,7 @@ int libfwsi_network_location_get_utf8_description(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_copy_utf8_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->description,
@@ -454,6 +644,208 @@ int libfwsi_network_location_get_utf8_description(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted description and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, the size is 0 when not available,
+ * a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if not available or the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_network_location_get_utf8_description_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_description_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_utf8_description_and_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_description_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 description size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_description_size = 0;
+
+	if( ( network_location_values->description == NULL )
+	 || ( network_location_values->description_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     network_location_values->description,
+	     network_location_values->description_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_description_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_description_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted description from the string cache of the item
+ * The UTF-8 string is converted when first retrieved and remains valid until the item is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_description(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_cached_utf8_description";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( network_location_values->description == NULL )
+	 || ( network_location_values->description_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_DESCRIPTION,
+	     network_location_values->description,
+	     network_location_values->description_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted description
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -656,7 +1048,7 @@ int libfwsi_network_location_get_utf8_comments_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_get_utf8_size_from_byte_stream(
 	     network_location_values->comments,
 	     network_location_values->comments_size,
 	     network_location_values->ascii_codepage,
@@ -730,7 +1122,7 @@ int libfwsi_network_location_get_utf8_comments(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_copy_utf8_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->comments,
@@ -750,6 +1142,208 @@ int libfwsi_network_location_get_utf8_comments(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted comments and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, the size is 0 when not available,
+ * a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if not available or the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_network_location_get_utf8_comments_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_comments_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_utf8_comments_and_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_comments_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 comments size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_comments_size = 0;
+
+	if( ( network_location_values->comments == NULL )
+	 || ( network_location_values->comments_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     network_location_values->comments,
+	     network_location_values->comments_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_comments_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_comments_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted comments from the string cache of the item
+ * The UTF-8 string is converted when first retrieved and remains valid until the item is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_network_location_get_cached_utf8_comments(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item                     = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	static char *function                                      = "libfwsi_network_location_get_cached_utf8_comments";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_NETWORK_LOCATION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( network_location_values->comments == NULL )
+	 || ( network_location_values->comments_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_COMMENTS,
+	     network_location_values->comments,
+	     network_location_values->comments_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     network_location_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted comments
  * Returns 1 if successful, 0 if not available or -1 on error
  */
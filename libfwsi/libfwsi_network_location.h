@@ -33,6 +33,15 @@
 extern "C" {
 #endif
 
+/* The indexes of the strings in the string cache of a network location
+ */
+enum LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEXES
+{
+	LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_LOCATION	= 0,
+	LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_DESCRIPTION	= 1,
+	LIBFWSI_NETWORK_LOCATION_STRING_CACHE_INDEX_COMMENTS	= 2
+};
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf8_location_size(
      libfwsi_item_t *item,
@@ -46,6 +55,21 @@ int libfwsi_network_location_get_utf8_location(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_utf8_location_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_location_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_location(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf16_location_size(
      libfwsi_item_t *item,
@@ -72,6 +96,21 @@ int libfwsi_network_location_get_utf8_description(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_utf8_description_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_description_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_description(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf16_description_size(
      libfwsi_item_t *item,
@@ -98,6 +137,21 @@ int libfwsi_network_location_get_utf8_comments(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_utf8_comments_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_comments_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_network_location_get_cached_utf8_comments(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_network_location_get_utf16_comments_size(
      libfwsi_item_t *item,
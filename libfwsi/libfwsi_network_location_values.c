@@ -24,12 +24,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_string.h"
 
 /* Creates network location values
  * Make sure the value network_location_values is referencing, is set to NULL
@@ -126,17 +128,23 @@ int libfwsi_network_location_values_free(
 	}
 	if( *network_location_values != NULL )
 	{
-		if( ( *network_location_values )->location != NULL )
+		if( ( ( *network_location_values )->location != NULL )
+		 && ( ( *network_location_values )->location != ( *network_location_values )->inline_location )
+		 && ( ( *network_location_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *network_location_values )->location );
 		}
-		if( ( *network_location_values )->description != NULL )
+		if( ( ( *network_location_values )->description != NULL )
+		 && ( ( *network_location_values )->description != ( *network_location_values )->inline_description )
+		 && ( ( *network_location_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *network_location_values )->description );
 		}
-		if( ( *network_location_values )->comments != NULL )
+		if( ( ( *network_location_values )->comments != NULL )
+		 && ( ( *network_location_values )->comments != ( *network_location_values )->inline_comments )
+		 && ( ( *network_location_values )->strings_are_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *network_location_values )->comments );
@@ -157,6 +165,8 @@ ssize_t libfwsi_network_location_values_read(
          const uint8_t *shell_item_data,
          size_t shell_item_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error )
 {
 	static char *function         = "libfwsi_network_location_values_read";
@@ -236,50 +246,56 @@ ssize_t libfwsi_network_location_values_read(
 		 flags );
 	}
 #endif
+	network_location_values->strings_are_borrowed = borrow_data;
+
 	shell_item_data_offset = 5;
 
 	/* Determine the network location
 	 */
-	for( string_size = shell_item_data_offset;
-	     string_size < shell_item_data_size;
-	     string_size++ )
-	{
-		if( shell_item_data[ string_size ] == 0 )
-		{
-			string_size++;
+	string_size = libfwsi_string_get_byte_stream_string_size(
+	              shell_item_data,
+	              shell_item_data_size,
+	              shell_item_data_offset );
 
-			break;
-		}
-	}
-	string_size -= shell_item_data_offset;
-
-	network_location_values->location = (uint8_t *) memory_allocate(
-	                                                 sizeof( uint8_t ) * string_size );
-
-	if( network_location_values->location == NULL )
+	if( borrow_data != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create location.",
-		 function );
-
-		goto on_error;
+		network_location_values->location = (uint8_t *) &( shell_item_data[ shell_item_data_offset ] );
 	}
-	if( memory_copy(
-	     network_location_values->location,
-	     &( shell_item_data[ shell_item_data_offset ] ),
-	     string_size ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy location.",
-		 function );
+		if( string_size <= LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_LOCATION_SIZE )
+		{
+			network_location_values->location = network_location_values->inline_location;
+		}
+		else if( libfwsi_arena_allocate(
+		          arena,
+		          sizeof( uint8_t ) * string_size,
+		          (void **) &( network_location_values->location ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create location.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( memory_copy(
+		     network_location_values->location,
+		     &( shell_item_data[ shell_item_data_offset ] ),
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy location.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	network_location_values->location_size = string_size;
 
@@ -312,46 +328,50 @@ ssize_t libfwsi_network_location_values_read(
 	{
 		/* Determine the network description
 		 */
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size++ )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size++;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
-		network_location_values->description = (uint8_t *) memory_allocate(
-		                                                    sizeof( uint8_t ) * string_size );
-
-		if( network_location_values->description == NULL )
+		if( borrow_data != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create description.",
-			 function );
-
-			goto on_error;
+			network_location_values->description = (uint8_t *) &( shell_item_data[ shell_item_data_offset ] );
 		}
-		if( memory_copy(
-		     network_location_values->description,
-		     &( shell_item_data[ shell_item_data_offset ] ),
-		     string_size ) == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy description.",
-			 function );
+			if( string_size <= LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_DESCRIPTION_SIZE )
+			{
+				network_location_values->description = network_location_values->inline_description;
+			}
+			else if( libfwsi_arena_allocate(
+			          arena,
+			          sizeof( uint8_t ) * string_size,
+			          (void **) &( network_location_values->description ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create description.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( memory_copy(
+			     network_location_values->description,
+			     &( shell_item_data[ shell_item_data_offset ] ),
+			     string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy description.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		network_location_values->description_size = string_size;
 
@@ -384,46 +404,50 @@ ssize_t libfwsi_network_location_values_read(
 	{
 		/* Determine the network comments
 		 */
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size++ )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size++;
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
-
-		network_location_values->comments = (uint8_t *) memory_allocate(
-		                                                 sizeof( uint8_t ) * string_size );
-
-		if( network_location_values->comments == NULL )
+		if( borrow_data != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create comments.",
-			 function );
-
-			goto on_error;
+			network_location_values->comments = (uint8_t *) &( shell_item_data[ shell_item_data_offset ] );
 		}
-		if( memory_copy(
-		     network_location_values->comments,
-		     &( shell_item_data[ shell_item_data_offset ] ),
-		     string_size ) == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy comments.",
-			 function );
+			if( string_size <= LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_COMMENTS_SIZE )
+			{
+				network_location_values->comments = network_location_values->inline_comments;
+			}
+			else if( libfwsi_arena_allocate(
+			          arena,
+			          sizeof( uint8_t ) * string_size,
+			          (void **) &( network_location_values->comments ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create comments.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( memory_copy(
+			     network_location_values->comments,
+			     &( shell_item_data[ shell_item_data_offset ] ),
+			     string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy comments.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		network_location_values->comments_size = string_size;
 
@@ -480,27 +504,39 @@ ssize_t libfwsi_network_location_values_read(
 on_error:
 	if( network_location_values->comments != NULL )
 	{
-		memory_free(
-		 network_location_values->comments );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( network_location_values->comments != network_location_values->inline_comments ) )
+		{
+			memory_free(
+			 network_location_values->comments );
+		}
 		network_location_values->comments = NULL;
 	}
 	network_location_values->comments_size = 0;
 
 	if( network_location_values->description != NULL )
 	{
-		memory_free(
-		 network_location_values->description );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( network_location_values->description != network_location_values->inline_description ) )
+		{
+			memory_free(
+			 network_location_values->description );
+		}
 		network_location_values->description = NULL;
 	}
 	network_location_values->description_size = 0;
 
 	if( network_location_values->location != NULL )
 	{
-		memory_free(
-		 network_location_values->location );
-
+		if( ( arena == NULL )
+		 && ( borrow_data == 0 )
+		 && ( network_location_values->location != network_location_values->inline_location ) )
+		{
+			memory_free(
+			 network_location_values->location );
+		}
 		network_location_values->location = NULL;
 	}
 	network_location_values->location_size = 0;
@@ -25,12 +25,25 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_arena.h"
 #include "libfwsi_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the inline location, longer locations are allocated separately
+ */
+#define LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_LOCATION_SIZE	32
+
+/* The size of the inline description, longer descriptions are allocated separately
+ */
+#define LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_DESCRIPTION_SIZE	16
+
+/* The size of the inline comments, longer comments are allocated separately
+ */
+#define LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_COMMENTS_SIZE	16
+
 typedef struct libfwsi_network_location_values libfwsi_network_location_values_t;
 
 struct libfwsi_network_location_values
@@ -43,6 +56,10 @@ struct libfwsi_network_location_values
 	 */
 	size_t location_size;
 
+	/* The inline location, used for locations that fit
+	 */
+	uint8_t inline_location[ LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_LOCATION_SIZE ];
+
 	/* The description
 	 */
 	uint8_t *description;
@@ -51,6 +68,10 @@ struct libfwsi_network_location_values
 	 */
 	size_t description_size;
 
+	/* The inline description, used for descriptions that fit
+	 */
+	uint8_t inline_description[ LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_DESCRIPTION_SIZE ];
+
 	/* The comments
 	 */
 	uint8_t *comments;
@@ -59,9 +80,17 @@ struct libfwsi_network_location_values
 	 */
 	size_t comments_size;
 
+	/* The inline comments, used for comments that fit
+	 */
+	uint8_t inline_comments[ LIBFWSI_NETWORK_LOCATION_VALUES_INLINE_COMMENTS_SIZE ];
+
 	/* The ASCII codepage
 	 */
 	int ascii_codepage;
+
+	/* Value to indicate if the strings reference the shell item data instead of a copy
+	 */
+	uint8_t strings_are_borrowed;
 };
 
 int libfwsi_network_location_values_initialize(
@@ -77,6 +106,8 @@ ssize_t libfwsi_network_location_values_read(
          const uint8_t *shell_item_data,
          size_t shell_item_data_size,
          int ascii_codepage,
+         libfwsi_arena_t *arena,
+         uint8_t borrow_data,
          libcerror_error_t **error );
 
 #if defined( __cplusplus )
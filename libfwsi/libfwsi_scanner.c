@@ -0,0 +1,1542 @@
+/*
+ * Shell item list scanner functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+#include <arm_neon.h>
+
+#endif
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_classifier.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_scanner.h"
+#include "libfwsi_unused.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "libfwsi_libcthreads.h"
+#endif
+
+/* Creates a scanner
+ * Make sure the value scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_initialize(
+     libfwsi_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_initialize";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = memory_allocate_structure(
+	                    libfwsi_internal_scanner_t );
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner,
+	     0,
+	     sizeof( libfwsi_internal_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanner.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->minimum_number_of_items = LIBFWSI_SCANNER_DEFAULT_MINIMUM_NUMBER_OF_ITEMS;
+	internal_scanner->number_of_threads       = 1;
+
+	*scanner = (libfwsi_scanner_t *) internal_scanner;
+
+	return( 1 );
+
+on_error:
+	if( internal_scanner != NULL )
+	{
+		memory_free(
+		 internal_scanner );
+	}
+	return( -1 );
+}
+
+/* Frees a scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_free(
+     libfwsi_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_free";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		internal_scanner = (libfwsi_internal_scanner_t *) *scanner;
+		*scanner         = NULL;
+
+		if( internal_scanner->results != NULL )
+		{
+			memory_free(
+			 internal_scanner->results );
+		}
+		memory_free(
+		 internal_scanner );
+	}
+	return( 1 );
+}
+
+/* Retrieves the minimum number of items of a candidate shell item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_get_minimum_number_of_items(
+     libfwsi_scanner_t *scanner,
+     int *minimum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_get_minimum_number_of_items";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( minimum_number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*minimum_number_of_items = internal_scanner->minimum_number_of_items;
+
+	return( 1 );
+}
+
+/* Sets the minimum number of items of a candidate shell item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_set_minimum_number_of_items(
+     libfwsi_scanner_t *scanner,
+     int minimum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_set_minimum_number_of_items";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( minimum_number_of_items < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->minimum_number_of_items = minimum_number_of_items;
+
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to scan a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_get_number_of_threads(
+     libfwsi_scanner_t *scanner,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_get_number_of_threads";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_scanner->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to scan a buffer
+ * Without multi-threading support a buffer is always scanned by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_set_number_of_threads(
+     libfwsi_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_set_number_of_threads";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Skips zero bytes in a buffer
+ * A shell item list cannot start within a run of zero bytes since its first size value would be 0
+ * Returns the offset of the first non-zero byte at or after the buffer offset or the buffer size if not found
+ */
+size_t libfwsi_scanner_skip_zero_bytes(
+        const uint8_t *buffer,
+        size_t buffer_size,
+        size_t buffer_offset )
+{
+#if defined( __SSE2__ )
+	__m128i zero_block = _mm_setzero_si128();
+	__m128i block;
+
+	while( ( buffer_size - buffer_offset ) >= 16 )
+	{
+		block = _mm_loadu_si128(
+		         (const __m128i *) &( buffer[ buffer_offset ] ) );
+
+		if( _mm_movemask_epi8( _mm_cmpeq_epi8( block, zero_block ) ) != 0xffff )
+		{
+			break;
+		}
+		buffer_offset += 16;
+	}
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	uint8x16_t block;
+
+	while( ( buffer_size - buffer_offset ) >= 16 )
+	{
+		block = vld1q_u8(
+		         &( buffer[ buffer_offset ] ) );
+
+		if( vmaxvq_u8( block ) != 0 )
+		{
+			break;
+		}
+		buffer_offset += 16;
+	}
+#else
+	uint64_t value_64bit = 0;
+
+	while( ( buffer_size - buffer_offset ) >= 8 )
+	{
+		memory_copy(
+		 &value_64bit,
+		 &( buffer[ buffer_offset ] ),
+		 8 );
+
+		if( value_64bit != 0 )
+		{
+			break;
+		}
+		buffer_offset += 8;
+	}
+#endif
+	while( ( buffer_offset < buffer_size )
+	    && ( buffer[ buffer_offset ] == 0 ) )
+	{
+		buffer_offset++;
+	}
+	return( buffer_offset );
+}
+
+/* Checks if the data of a shell item looks like a known shell item
+ * The caller is responsible for ensuring that the byte stream contains at least data_size bytes
+ * Returns 1 if the item is a candidate shell item or 0 if not
+ */
+int libfwsi_scanner_check_item(
+     const uint8_t *byte_stream,
+     uint16_t data_size )
+{
+	uint32_t signature = 0;
+	uint8_t class_type = 0;
+	int item_type      = 0;
+
+	if( data_size < 3 )
+	{
+		return( 0 );
+	}
+	item_type = libfwsi_item_classifier_classify(
+	             byte_stream,
+	             data_size,
+	             &class_type,
+	             &signature );
+
+	if( item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+	{
+		return( 0 );
+	}
+	/* The extension blocks of a file entry shell item are validated
+	 * as when the shell item list is validated
+	 */
+	if( item_type == LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	{
+		return( libfwsi_item_validate(
+		         byte_stream,
+		         data_size ) );
+	}
+	return( 1 );
+}
+
+/* Checks if a byte stream starts with a candidate shell item list
+ * The items are chained by their size values and the list is terminated by an empty item
+ * Returns 1 if the byte stream starts with a candidate shell item list or 0 if not
+ */
+int libfwsi_scanner_check_item_list(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *list_size,
+     int *number_of_items )
+{
+	size_t byte_stream_offset = 0;
+	uint16_t item_data_size   = 0;
+	int item_index            = 0;
+
+	while( ( byte_stream_size - byte_stream_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 item_data_size );
+
+		if( item_data_size == 0 )
+		{
+			if( item_index == 0 )
+			{
+				return( 0 );
+			}
+			*list_size       = byte_stream_offset + 2;
+			*number_of_items = item_index;
+
+			return( 1 );
+		}
+		/* The item must be followed by at least a terminator
+		 */
+		if( (size_t) item_data_size > ( byte_stream_size - byte_stream_offset - 2 ) )
+		{
+			return( 0 );
+		}
+		if( libfwsi_scanner_check_item(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     item_data_size ) != 1 )
+		{
+			return( 0 );
+		}
+		if( item_index == INT_MAX )
+		{
+			return( 0 );
+		}
+		byte_stream_offset += item_data_size;
+
+		item_index++;
+	}
+	return( 0 );
+}
+
+/* Appends a result to an array of results
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_results_append(
+     libfwsi_scanner_result_t **results,
+     int *number_of_results,
+     int *number_of_allocated_results,
+     size_t offset,
+     size_t size,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_scanner_result_t *reallocated_results = NULL;
+	libfwsi_scanner_result_t *result              = NULL;
+	static char *function                         = "libfwsi_scanner_results_append";
+	int new_number_of_allocated_results           = 0;
+
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated results.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_results >= *number_of_allocated_results )
+	{
+		if( *number_of_allocated_results == 0 )
+		{
+			new_number_of_allocated_results = 16;
+		}
+		else if( *number_of_allocated_results < ( INT_MAX / 2 ) )
+		{
+			new_number_of_allocated_results = *number_of_allocated_results * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated results value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocated_results = (libfwsi_scanner_result_t *) memory_reallocate(
+		                                                    *results,
+		                                                    sizeof( libfwsi_scanner_result_t ) * new_number_of_allocated_results );
+
+		if( reallocated_results == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize results.",
+			 function );
+
+			return( -1 );
+		}
+		*results                     = reallocated_results;
+		*number_of_allocated_results = new_number_of_allocated_results;
+	}
+	result = &( ( *results )[ *number_of_results ] );
+
+	result->offset          = offset;
+	result->size            = size;
+	result->number_of_items = number_of_items;
+
+	*number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Scans a chunk of a buffer for candidate shell item lists
+ * Candidates do not overlap, at every offset the first candidate found is used
+ * and scanning continues after its end
+ * Only candidates that start within the chunk are used but they can extend beyond
+ * the end of the chunk into the remainder of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_chunk_scan(
+     libfwsi_scanner_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_scanner_chunk_scan";
+	size_t buffer_offset   = 0;
+	size_t list_size       = 0;
+	size_t non_zero_offset = 0;
+	size_t skip_end_offset = 0;
+	int number_of_items    = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->start_offset > chunk->end_offset )
+	 || ( chunk->end_offset > chunk->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - offsets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A candidate that starts at the last offset of the chunk can have
+	 * its first non-zero byte directly after the chunk
+	 */
+	if( chunk->end_offset < chunk->buffer_size )
+	{
+		skip_end_offset = chunk->end_offset + 1;
+	}
+	else
+	{
+		skip_end_offset = chunk->buffer_size;
+	}
+	buffer_offset = chunk->start_offset;
+
+	/* The smallest shell item list consists of an item of 3 bytes and a terminator
+	 */
+	while( ( buffer_offset < chunk->end_offset )
+	    && ( ( chunk->buffer_size - buffer_offset ) >= 5 ) )
+	{
+		non_zero_offset = libfwsi_scanner_skip_zero_bytes(
+		                   chunk->buffer,
+		                   skip_end_offset,
+		                   buffer_offset );
+
+		if( non_zero_offset >= skip_end_offset )
+		{
+			break;
+		}
+		/* The size value can start with the zero byte preceding the non-zero byte
+		 */
+		if( non_zero_offset > buffer_offset )
+		{
+			buffer_offset = non_zero_offset - 1;
+		}
+		if( libfwsi_scanner_check_item_list(
+		     &( chunk->buffer[ buffer_offset ] ),
+		     chunk->buffer_size - buffer_offset,
+		     &list_size,
+		     &number_of_items ) == 1 )
+		{
+			if( number_of_items >= chunk->minimum_number_of_items )
+			{
+				if( libfwsi_scanner_results_append(
+				     &( chunk->results ),
+				     &( chunk->number_of_results ),
+				     &( chunk->number_of_allocated_results ),
+				     buffer_offset,
+				     list_size,
+				     number_of_items,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append result.",
+					 function );
+
+					return( -1 );
+				}
+				buffer_offset += list_size;
+
+				continue;
+			}
+		}
+		buffer_offset++;
+	}
+	if( buffer_offset < chunk->end_offset )
+	{
+		buffer_offset = chunk->end_offset;
+	}
+	chunk->next_offset = buffer_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the scanner thread pool to scan a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_chunk_scan_callback(
+     libfwsi_scanner_chunk_t *chunk,
+     void *arguments LIBFWSI_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfwsi_scanner_chunk_scan_callback";
+
+	LIBFWSI_UNREFERENCED_PARAMETER( arguments )
+
+	if( chunk == NULL )
+	{
+		return( -1 );
+	}
+	chunk->scan_result = libfwsi_scanner_chunk_scan(
+	                      chunk,
+	                      &error );
+
+	if( chunk->scan_result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( chunk->scan_result );
+}
+
+/* Scans a buffer for candidate shell item lists using multiple threads
+ * The buffer is split into chunks that are scanned by a thread pool, after which
+ * the candidates of the chunks are merged in offset order, which results in
+ * the same candidates as scanning the buffer with a single thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_scanner_scan_buffer_multi_threaded(
+     libfwsi_internal_scanner_t *internal_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfwsi_scanner_chunk_t rescan_chunk;
+
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	libfwsi_scanner_chunk_t *chunk         = NULL;
+	libfwsi_scanner_chunk_t *chunks        = NULL;
+	libfwsi_scanner_result_t *result       = NULL;
+	static char *function                  = "libfwsi_internal_scanner_scan_buffer_multi_threaded";
+	size_t buffer_offset                   = 0;
+	size_t number_of_chunks                = 0;
+	size_t next_offset                     = 0;
+	int chunk_index                        = 0;
+	int rescan_result_index                = 0;
+	int result_index                       = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &rescan_chunk,
+	     0,
+	     sizeof( libfwsi_scanner_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rescan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = buffer_size / LIBFWSI_SCANNER_CHUNK_SIZE;
+
+	if( ( buffer_size % LIBFWSI_SCANNER_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( ( number_of_chunks == 0 )
+	 || ( number_of_chunks > (size_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	chunks = (libfwsi_scanner_chunk_t *) memory_allocate(
+	                                      sizeof( libfwsi_scanner_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chunks,
+	     0,
+	     sizeof( libfwsi_scanner_chunk_t ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < (int) number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk = &( chunks[ chunk_index ] );
+
+		chunk->buffer                  = buffer;
+		chunk->buffer_size             = buffer_size;
+		chunk->start_offset            = buffer_offset;
+		chunk->minimum_number_of_items = internal_scanner->minimum_number_of_items;
+		chunk->scan_result             = -1;
+
+		if( ( buffer_size - buffer_offset ) > LIBFWSI_SCANNER_CHUNK_SIZE )
+		{
+			buffer_offset += LIBFWSI_SCANNER_CHUNK_SIZE;
+		}
+		else
+		{
+			buffer_offset = buffer_size;
+		}
+		chunk->end_offset = buffer_offset;
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     internal_scanner->number_of_threads,
+	     (int) number_of_chunks,
+	     (int (*)(intptr_t *, void *)) &libfwsi_scanner_chunk_scan_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < (int) number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) &( chunks[ chunk_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk: %d onto thread pool queue.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* Merge the candidates of the chunks in offset order
+	 *
+	 * A chunk is scanned from its start offset, while scanning the buffer with a single
+	 * thread would continue at the end of the last candidate of the preceding chunks.
+	 * Both scans give the same candidates from the first offset they both visit, hence
+	 * any part of the chunk that lies within a candidate of the chunk is rescanned
+	 */
+	for( chunk_index = 0;
+	     chunk_index < (int) number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk = &( chunks[ chunk_index ] );
+
+		if( chunk->scan_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		result_index = 0;
+
+		while( next_offset < chunk->end_offset )
+		{
+			while( ( result_index < chunk->number_of_results )
+			    && ( ( chunk->results[ result_index ].offset + chunk->results[ result_index ].size ) <= next_offset ) )
+			{
+				result_index++;
+			}
+			if( ( result_index >= chunk->number_of_results )
+			 || ( chunk->results[ result_index ].offset >= next_offset ) )
+			{
+				while( result_index < chunk->number_of_results )
+				{
+					result = &( chunk->results[ result_index ] );
+
+					if( libfwsi_scanner_results_append(
+					     &( internal_scanner->results ),
+					     &( internal_scanner->number_of_results ),
+					     &( internal_scanner->number_of_allocated_results ),
+					     result->offset,
+					     result->size,
+					     result->number_of_items,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append result.",
+						 function );
+
+						goto on_error;
+					}
+					result_index++;
+				}
+				next_offset = chunk->next_offset;
+
+				break;
+			}
+			/* The next offset lies within a candidate of the chunk, rescan
+			 * up to the end of that candidate
+			 */
+			rescan_chunk.buffer                  = buffer;
+			rescan_chunk.buffer_size             = buffer_size;
+			rescan_chunk.start_offset            = next_offset;
+			rescan_chunk.end_offset              = chunk->results[ result_index ].offset + chunk->results[ result_index ].size;
+			rescan_chunk.minimum_number_of_items = internal_scanner->minimum_number_of_items;
+			rescan_chunk.number_of_results       = 0;
+
+			if( rescan_chunk.end_offset > chunk->end_offset )
+			{
+				rescan_chunk.end_offset = chunk->end_offset;
+			}
+			if( libfwsi_scanner_chunk_scan(
+			     &rescan_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to rescan chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			for( rescan_result_index = 0;
+			     rescan_result_index < rescan_chunk.number_of_results;
+			     rescan_result_index++ )
+			{
+				result = &( rescan_chunk.results[ rescan_result_index ] );
+
+				if( libfwsi_scanner_results_append(
+				     &( internal_scanner->results ),
+				     &( internal_scanner->number_of_results ),
+				     &( internal_scanner->number_of_allocated_results ),
+				     result->offset,
+				     result->size,
+				     result->number_of_items,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append result.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			next_offset = rescan_chunk.next_offset;
+		}
+		if( chunk->results != NULL )
+		{
+			memory_free(
+			 chunk->results );
+
+			chunk->results = NULL;
+		}
+	}
+	if( rescan_chunk.results != NULL )
+	{
+		memory_free(
+		 rescan_chunk.results );
+	}
+	memory_free(
+	 chunks );
+
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( rescan_chunk.results != NULL )
+	{
+		memory_free(
+		 rescan_chunk.results );
+	}
+	if( chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < (int) number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].results != NULL )
+			{
+				memory_free(
+				 chunks[ chunk_index ].results );
+			}
+		}
+		memory_free(
+		 chunks );
+	}
+	internal_scanner->number_of_results = 0;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Scans a window of a buffer for candidate shell item lists using a single thread
+ * The offsets of the results are relative to the start of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_scanner_scan_window(
+     libfwsi_internal_scanner_t *internal_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t window_start_offset,
+     size_t window_end_offset,
+     size_t *next_offset,
+     libcerror_error_t **error )
+{
+	libfwsi_scanner_chunk_t chunk;
+
+	static char *function = "libfwsi_internal_scanner_scan_window";
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &chunk,
+	     0,
+	     sizeof( libfwsi_scanner_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk.",
+		 function );
+
+		return( -1 );
+	}
+	chunk.buffer                      = buffer;
+	chunk.buffer_size                 = buffer_size;
+	chunk.start_offset                = window_start_offset;
+	chunk.end_offset                  = window_end_offset;
+	chunk.minimum_number_of_items     = internal_scanner->minimum_number_of_items;
+	chunk.results                     = internal_scanner->results;
+	chunk.number_of_allocated_results = internal_scanner->number_of_allocated_results;
+
+	result = libfwsi_scanner_chunk_scan(
+	          &chunk,
+	          error );
+
+	/* The results can have been reallocated even if the scan failed
+	 */
+	internal_scanner->results                     = chunk.results;
+	internal_scanner->number_of_results           = chunk.number_of_results;
+	internal_scanner->number_of_allocated_results = chunk.number_of_allocated_results;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk.",
+		 function );
+
+		internal_scanner->number_of_results = 0;
+
+		return( -1 );
+	}
+	*next_offset = chunk.next_offset;
+
+	return( 1 );
+}
+
+/* Scans a buffer for candidate shell item lists
+ * The results of a previous scan are replaced
+ * Candidates do not overlap, at every offset the first candidate found is used
+ * and scanning continues after its end
+ * Buffers larger than a single chunk are scanned using multiple threads if more than 1 thread is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_scan_buffer(
+     libfwsi_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_scan_buffer";
+	size_t next_offset                           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->number_of_results = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( internal_scanner->number_of_threads > 1 )
+	 && ( buffer_size > LIBFWSI_SCANNER_CHUNK_SIZE ) )
+	{
+		if( libfwsi_internal_scanner_scan_buffer_multi_threaded(
+		     internal_scanner,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer using multiple threads.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( libfwsi_internal_scanner_scan_window(
+	     internal_scanner,
+	     buffer,
+	     buffer_size,
+	     0,
+	     buffer_size,
+	     &next_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a window of a buffer for candidate shell item lists
+ * The buffer can be part of a larger data stream, the base offset is the offset
+ * of the start of the buffer in the data stream and is added to the offsets of the results
+ * Only candidates that start in the window, from the window start offset up to
+ * the window end offset, are reported, the data after the window end offset is only used
+ * to read the candidates that start in the window
+ * The next offset is set to the offset, relative to the start of the buffer, at which
+ * scanning continues in the next window, this is past the end of the last candidate found
+ * The results of a previous scan are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_scan_buffer_window(
+     libfwsi_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t base_offset,
+     size_t window_start_offset,
+     size_t window_end_offset,
+     size_t *next_offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_scan_buffer_window";
+	int result_index                             = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_offset > ( (size_t) SSIZE_MAX - buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_start_offset > window_end_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next offset.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->number_of_results = 0;
+
+	if( libfwsi_internal_scanner_scan_window(
+	     internal_scanner,
+	     buffer,
+	     buffer_size,
+	     window_start_offset,
+	     window_end_offset,
+	     next_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan window.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < internal_scanner->number_of_results;
+	     result_index++ )
+	{
+		internal_scanner->results[ result_index ].offset += base_offset;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of results of the last scan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_get_number_of_results(
+     libfwsi_scanner_t *scanner,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	static char *function                        = "libfwsi_scanner_get_number_of_results";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_results = internal_scanner->number_of_results;
+
+	return( 1 );
+}
+
+/* Retrieves a specific result of the last scan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_scanner_get_result_by_index(
+     libfwsi_scanner_t *scanner,
+     int result_index,
+     size_t *offset,
+     size_t *size,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_scanner_t *internal_scanner = NULL;
+	libfwsi_scanner_result_t *result             = NULL;
+	static char *function                        = "libfwsi_scanner_get_result_by_index";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libfwsi_internal_scanner_t *) scanner;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_scanner->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( internal_scanner->results[ result_index ] );
+
+	*offset          = result->offset;
+	*size            = result->size;
+	*number_of_items = result->number_of_items;
+
+	return( 1 );
+}
+
@@ -0,0 +1,255 @@
+/*
+ * Shell item list scanner functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_SCANNER_H )
+#define _LIBFWSI_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default minimum number of items of a candidate shell item list
+ */
+#define LIBFWSI_SCANNER_DEFAULT_MINIMUM_NUMBER_OF_ITEMS	2
+
+/* The size of the chunks of a buffer that are scanned by the worker threads
+ */
+#define LIBFWSI_SCANNER_CHUNK_SIZE				( 16 * 1024 * 1024 )
+
+typedef struct libfwsi_scanner_result libfwsi_scanner_result_t;
+
+struct libfwsi_scanner_result
+{
+	/* The offset of the shell item list relative to the start of the buffer
+	 * or for a window scan to the start of the data stream
+	 */
+	size_t offset;
+
+	/* The size of the shell item list including the terminator
+	 */
+	size_t size;
+
+	/* The number of items
+	 */
+	int number_of_items;
+};
+
+typedef struct libfwsi_scanner_chunk libfwsi_scanner_chunk_t;
+
+struct libfwsi_scanner_chunk
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset of the first candidate start offset in the chunk
+	 */
+	size_t start_offset;
+
+	/* The offset directly after the last candidate start offset in the chunk
+	 */
+	size_t end_offset;
+
+	/* The offset at which scanning continues after the chunk
+	 */
+	size_t next_offset;
+
+	/* The minimum number of items of a candidate shell item list
+	 */
+	int minimum_number_of_items;
+
+	/* The results
+	 */
+	libfwsi_scanner_result_t *results;
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+
+	/* The scan result, 1 if successful or -1 on error
+	 */
+	int scan_result;
+};
+
+typedef struct libfwsi_internal_scanner libfwsi_internal_scanner_t;
+
+struct libfwsi_internal_scanner
+{
+	/* The minimum number of items of a candidate shell item list
+	 */
+	int minimum_number_of_items;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The results
+	 */
+	libfwsi_scanner_result_t *results;
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_initialize(
+     libfwsi_scanner_t **scanner,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_free(
+     libfwsi_scanner_t **scanner,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_get_minimum_number_of_items(
+     libfwsi_scanner_t *scanner,
+     int *minimum_number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_set_minimum_number_of_items(
+     libfwsi_scanner_t *scanner,
+     int minimum_number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_get_number_of_threads(
+     libfwsi_scanner_t *scanner,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_set_number_of_threads(
+     libfwsi_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+size_t libfwsi_scanner_skip_zero_bytes(
+        const uint8_t *buffer,
+        size_t buffer_size,
+        size_t buffer_offset );
+
+int libfwsi_scanner_check_item(
+     const uint8_t *byte_stream,
+     uint16_t data_size );
+
+int libfwsi_scanner_check_item_list(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *list_size,
+     int *number_of_items );
+
+int libfwsi_scanner_results_append(
+     libfwsi_scanner_result_t **results,
+     int *number_of_results,
+     int *number_of_allocated_results,
+     size_t offset,
+     size_t size,
+     int number_of_items,
+     libcerror_error_t **error );
+
+int libfwsi_scanner_chunk_scan(
+     libfwsi_scanner_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwsi_scanner_chunk_scan_callback(
+     libfwsi_scanner_chunk_t *chunk,
+     void *arguments );
+
+int libfwsi_internal_scanner_scan_buffer_multi_threaded(
+     libfwsi_internal_scanner_t *internal_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libfwsi_internal_scanner_scan_window(
+     libfwsi_internal_scanner_t *internal_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t window_start_offset,
+     size_t window_end_offset,
+     size_t *next_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_scan_buffer(
+     libfwsi_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_scan_buffer_window(
+     libfwsi_scanner_t *scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t base_offset,
+     size_t window_start_offset,
+     size_t window_end_offset,
+     size_t *next_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_get_number_of_results(
+     libfwsi_scanner_t *scanner,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_scanner_get_result_by_index(
+     libfwsi_scanner_t *scanner,
+     int result_index,
+     size_t *offset,
+     size_t *size,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_SCANNER_H ) */
+
@@ -0,0 +1,671 @@
+/*
+ * Stream parser functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_codepage.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_stream_parser.h"
+#include "libfwsi_types.h"
+
+/* Creates a stream parser
+ * Make sure the value stream_parser is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_stream_parser_initialize(
+     libfwsi_stream_parser_t **stream_parser,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_initialize";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = memory_allocate_structure(
+	                          libfwsi_internal_stream_parser_t );
+
+	if( internal_stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream_parser,
+	     0,
+	     sizeof( libfwsi_internal_stream_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream parser.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream_parser->ascii_codepage = ascii_codepage;
+
+	*stream_parser = (libfwsi_stream_parser_t *) internal_stream_parser;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream_parser != NULL )
+	{
+		memory_free(
+		 internal_stream_parser );
+	}
+	return( -1 );
+}
+
+/* Frees a stream parser
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_stream_parser_free(
+     libfwsi_stream_parser_t **stream_parser,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_free";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_parser != NULL )
+	{
+		internal_stream_parser = (libfwsi_internal_stream_parser_t *) *stream_parser;
+		*stream_parser         = NULL;
+
+		if( internal_stream_parser->item_data != NULL )
+		{
+			memory_free(
+			 internal_stream_parser->item_data );
+		}
+		memory_free(
+		 internal_stream_parser );
+	}
+	return( 1 );
+}
+
+/* Resets a stream parser so that it can parse another item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_stream_parser_reset(
+     libfwsi_stream_parser_t *stream_parser,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_reset";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libfwsi_internal_stream_parser_t *) stream_parser;
+
+	internal_stream_parser->item_data_size   = 0;
+	internal_stream_parser->item_data_offset = 0;
+	internal_stream_parser->stream_offset    = 0;
+	internal_stream_parser->number_of_items  = 0;
+	internal_stream_parser->is_finished      = 0;
+
+	return( 1 );
+}
+
+/* Reads an item from a byte stream that contains exactly the data of the item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_stream_parser_read_item(
+     libfwsi_internal_stream_parser_t *internal_stream_parser,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_stream_parser_read_item";
+
+	if( internal_stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_item_initialize(
+	     item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwsi_item_copy_from_byte_stream(
+	     *item,
+	     byte_stream,
+	     byte_stream_size,
+	     internal_stream_parser->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to item: %d.",
+		 function,
+		 internal_stream_parser->number_of_items );
+
+		goto on_error;
+	}
+	internal_stream_parser->number_of_items += 1;
+
+	return( 1 );
+
+on_error:
+	if( *item != NULL )
+	{
+		libfwsi_item_free(
+		 item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pushes data to a stream parser
+ * The data is consumed until an item is complete, the terminator is read or the data is exhausted,
+ * the consumed data size indicates the size of the data that was consumed and the remainder
+ * of the data should be pushed again
+ * An item that is contained in the data is read directly from the data, otherwise the data
+ * of the item is retained until the remainder of the item is pushed, hence at most 1 item is buffered
+ * The item should be freed by the caller with libfwsi_item_free
+ * An item that cannot be read is consumed, hence pushing can continue with the next item
+ * Returns 1 if an item is available, 0 if more data is needed or the terminator was read or -1 on error
+ */
+int libfwsi_stream_parser_push_data(
+     libfwsi_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *consumed_data_size,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_push_data";
+	void *reallocation                                       = NULL;
+	size_t data_offset                                       = 0;
+	size_t read_size                                         = 0;
+	uint16_t item_data_size                                  = 0;
+	int result                                               = 0;
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libfwsi_internal_stream_parser_t *) stream_parser;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( consumed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid consumed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*consumed_data_size = 0;
+
+	while( ( internal_stream_parser->is_finished == 0 )
+	    && ( data_offset < data_size ) )
+	{
+		if( internal_stream_parser->item_data_size == 0 )
+		{
+			if( ( internal_stream_parser->item_data_offset == 0 )
+			 && ( ( data_size - data_offset ) >= 2 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data[ data_offset ] ),
+				 item_data_size );
+
+				/* An item that is contained in the data is read without buffering
+				 */
+				if( ( item_data_size >= 2 )
+				 && ( (size_t) item_data_size <= ( data_size - data_offset ) ) )
+				{
+					result = libfwsi_internal_stream_parser_read_item(
+					          internal_stream_parser,
+					          &( data[ data_offset ] ),
+					          (size_t) item_data_size,
+					          item,
+					          error );
+
+					data_offset                           += item_data_size;
+					internal_stream_parser->stream_offset += item_data_size;
+
+					*consumed_data_size = data_offset;
+
+					if( result != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read item at offset: %" PRIzu ".",
+						 function,
+						 internal_stream_parser->stream_offset - item_data_size );
+
+						return( -1 );
+					}
+					return( 1 );
+				}
+				data_offset                           += 2;
+				internal_stream_parser->stream_offset += 2;
+			}
+			else
+			{
+				if( internal_stream_parser->allocated_item_data_size < 2 )
+				{
+					reallocation = memory_reallocate(
+					                internal_stream_parser->item_data,
+					                sizeof( uint8_t ) * 2 );
+
+					if( reallocation == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize item data.",
+						 function );
+
+						return( -1 );
+					}
+					internal_stream_parser->item_data                = (uint8_t *) reallocation;
+					internal_stream_parser->allocated_item_data_size = 2;
+				}
+				internal_stream_parser->item_data[ internal_stream_parser->item_data_offset ] = data[ data_offset ];
+
+				internal_stream_parser->item_data_offset += 1;
+				internal_stream_parser->stream_offset    += 1;
+				data_offset                              += 1;
+
+				if( internal_stream_parser->item_data_offset < 2 )
+				{
+					continue;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 internal_stream_parser->item_data,
+				 item_data_size );
+			}
+			internal_stream_parser->item_data_offset = 0;
+
+			if( item_data_size == 0 )
+			{
+				internal_stream_parser->is_finished = 1;
+
+				break;
+			}
+			if( item_data_size < 2 )
+			{
+				/* The size of the item is smaller than its size value hence the stream cannot be continued
+				 */
+				internal_stream_parser->is_finished = 1;
+
+				*consumed_data_size = data_offset;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid item size value out of bounds at offset: %" PRIzu ".",
+				 function,
+				 internal_stream_parser->stream_offset - 2 );
+
+				return( -1 );
+			}
+			if( (size_t) item_data_size > internal_stream_parser->allocated_item_data_size )
+			{
+				reallocation = memory_reallocate(
+				                internal_stream_parser->item_data,
+				                sizeof( uint8_t ) * item_data_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize item data.",
+					 function );
+
+					return( -1 );
+				}
+				internal_stream_parser->item_data                = (uint8_t *) reallocation;
+				internal_stream_parser->allocated_item_data_size = (size_t) item_data_size;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 internal_stream_parser->item_data,
+			 item_data_size );
+
+			internal_stream_parser->item_data_size   = (size_t) item_data_size;
+			internal_stream_parser->item_data_offset = 2;
+		}
+		read_size = internal_stream_parser->item_data_size - internal_stream_parser->item_data_offset;
+
+		if( read_size > ( data_size - data_offset ) )
+		{
+			read_size = data_size - data_offset;
+		}
+		if( memory_copy(
+		     &( internal_stream_parser->item_data[ internal_stream_parser->item_data_offset ] ),
+		     &( data[ data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy item data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_stream_parser->item_data_offset += read_size;
+		internal_stream_parser->stream_offset    += read_size;
+		data_offset                              += read_size;
+
+		if( internal_stream_parser->item_data_offset < internal_stream_parser->item_data_size )
+		{
+			continue;
+		}
+		result = libfwsi_internal_stream_parser_read_item(
+		          internal_stream_parser,
+		          internal_stream_parser->item_data,
+		          internal_stream_parser->item_data_size,
+		          item,
+		          error );
+
+		internal_stream_parser->item_data_size   = 0;
+		internal_stream_parser->item_data_offset = 0;
+
+		*consumed_data_size = data_offset;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read item.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	*consumed_data_size = data_offset;
+
+	return( 0 );
+}
+
+/* Determines if the stream parser has finished
+ * The stream parser has finished when the terminator was read or the stream cannot be continued
+ * Returns 1 if finished, 0 if not or -1 on error
+ */
+int libfwsi_stream_parser_is_finished(
+     libfwsi_stream_parser_t *stream_parser,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_is_finished";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libfwsi_internal_stream_parser_t *) stream_parser;
+
+	if( internal_stream_parser->is_finished != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of items that were read
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_stream_parser_get_number_of_items(
+     libfwsi_stream_parser_t *stream_parser,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_get_number_of_items";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libfwsi_internal_stream_parser_t *) stream_parser;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_items = internal_stream_parser->number_of_items;
+
+	return( 1 );
+}
+
+/* Retrieves the current offset in the stream
+ * The offset is the total size of the data that was consumed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_stream_parser_get_offset(
+     libfwsi_stream_parser_t *stream_parser,
+     size_t *offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                    = "libfwsi_stream_parser_get_offset";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libfwsi_internal_stream_parser_t *) stream_parser;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_stream_parser->stream_offset;
+
+	return( 1 );
+}
+
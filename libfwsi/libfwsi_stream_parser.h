@@ -0,0 +1,127 @@
+/*
+ * Stream parser functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_STREAM_PARSER_H )
+#define _LIBFWSI_STREAM_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_stream_parser libfwsi_internal_stream_parser_t;
+
+struct libfwsi_internal_stream_parser
+{
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The item data, contains the part of an item that was pushed in previous data
+	 */
+	uint8_t *item_data;
+
+	/* The allocated item data size
+	 */
+	size_t allocated_item_data_size;
+
+	/* The item data size, 0 if the size of the item is not yet known
+	 */
+	size_t item_data_size;
+
+	/* The item data offset, the number of bytes of the item that were pushed
+	 */
+	size_t item_data_offset;
+
+	/* The stream offset
+	 */
+	size_t stream_offset;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* Value to indicate the terminator was read or the stream cannot be continued
+	 */
+	uint8_t is_finished;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_initialize(
+     libfwsi_stream_parser_t **stream_parser,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_free(
+     libfwsi_stream_parser_t **stream_parser,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_reset(
+     libfwsi_stream_parser_t *stream_parser,
+     libcerror_error_t **error );
+
+int libfwsi_internal_stream_parser_read_item(
+     libfwsi_internal_stream_parser_t *internal_stream_parser,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfwsi_item_t **item,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_push_data(
+     libfwsi_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *consumed_data_size,
+     libfwsi_item_t **item,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_is_finished(
+     libfwsi_stream_parser_t *stream_parser,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_get_number_of_items(
+     libfwsi_stream_parser_t *stream_parser,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_stream_parser_get_offset(
+     libfwsi_stream_parser_t *stream_parser,
+     size_t *offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_STREAM_PARSER_H ) */
+
@@ -0,0 +1,1456 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+#include <arm_neon.h>
+
+#endif
+
+#include "libfwsi_arena.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
+
+/* Scans a string for 7-bit ASCII characters
+ * Returns the offset of the first byte that is 0 or not 7-bit ASCII or the string size if not found
+ */
+size_t libfwsi_string_scan_7bit_ascii(
+        const uint8_t *string,
+        size_t string_size )
+{
+	size_t string_index = 0;
+
+#if defined( __SSE2__ )
+	__m128i zero_block = _mm_setzero_si128();
+	__m128i block;
+
+	while( ( string_size - string_index ) >= 16 )
+	{
+		block = _mm_loadu_si128(
+		         (const __m128i *) &( string[ string_index ] ) );
+
+		/* The most significant bit of the bytes is set for bytes that are not 7-bit ASCII
+		 */
+		if( ( _mm_movemask_epi8( block ) | _mm_movemask_epi8( _mm_cmpeq_epi8( block, zero_block ) ) ) != 0 )
+		{
+			break;
+		}
+		string_index += 16;
+	}
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	uint8x16_t block;
+
+	while( ( string_size - string_index ) >= 16 )
+	{
+		block = vld1q_u8(
+		         &( string[ string_index ] ) );
+
+		if( ( vmaxvq_u8( block ) >= 0x80 )
+		 || ( vminvq_u8( block ) == 0 ) )
+		{
+			break;
+		}
+		string_index += 16;
+	}
+#else
+	uint64_t value_64bit = 0;
+
+	while( ( string_size - string_index ) >= 8 )
+	{
+		memory_copy(
+		 &value_64bit,
+		 &( string[ string_index ] ),
+		 8 );
+
+		/* Adding 0x7f to the lower 7 bits of a byte sets its most significant bit
+		 * if the byte is not 0, without a carry into the next byte
+		 */
+		if( ( ( ( value_64bit & 0x7f7f7f7f7f7f7f7fULL ) + 0x7f7f7f7f7f7f7f7fULL ) & ~value_64bit & 0x8080808080808080ULL ) != 0x8080808080808080ULL )
+		{
+			break;
+		}
+		string_index += 8;
+	}
+#endif
+	while( ( string_index < string_size )
+	    && ( string[ string_index ] != 0 )
+	    && ( string[ string_index ] < 0x80 ) )
+	{
+		string_index++;
+	}
+	return( string_index );
+}
+
+/* Determines the size of a byte stream string including the end of string character
+ * Returns the size of the string at the byte stream offset up to and including the first 0-byte,
+ * the remaining size of the byte stream if not found or 0 if the offset is out of bounds
+ */
+size_t libfwsi_string_get_byte_stream_string_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        size_t byte_stream_offset )
+{
+#if defined( __SSE2__ )
+	__m128i zero_block       = _mm_setzero_si128();
+	__m128i block;
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	uint8x16_t block;
+
+#else
+	uint64_t value_64bit     = 0;
+
+#endif
+	size_t byte_stream_index = byte_stream_offset;
+
+	if( ( byte_stream == NULL )
+	 || ( byte_stream_offset >= byte_stream_size ) )
+	{
+		return( 0 );
+	}
+#if defined( __SSE2__ )
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		block = _mm_loadu_si128(
+		         (const __m128i *) &( byte_stream[ byte_stream_index ] ) );
+
+		if( _mm_movemask_epi8( _mm_cmpeq_epi8( block, zero_block ) ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 16;
+	}
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		block = vld1q_u8(
+		         &( byte_stream[ byte_stream_index ] ) );
+
+		if( vminvq_u8( block ) == 0 )
+		{
+			break;
+		}
+		byte_stream_index += 16;
+	}
+#else
+	while( ( byte_stream_size - byte_stream_index ) >= 8 )
+	{
+		memory_copy(
+		 &value_64bit,
+		 &( byte_stream[ byte_stream_index ] ),
+		 8 );
+
+		/* Subtracting 1 from a 0-byte sets its most significant bit
+		 */
+		if( ( ( value_64bit - 0x0101010101010101ULL ) & ~value_64bit & 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 8;
+	}
+#endif
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream[ byte_stream_index ] == 0 )
+		{
+			return( byte_stream_index + 1 - byte_stream_offset );
+		}
+		byte_stream_index++;
+	}
+	return( byte_stream_size - byte_stream_offset );
+}
+
+/* Determines the size of a UTF-16 stream string including the end of string character
+ * The end of string character is a pair of 0-bytes at an even distance from the byte stream offset
+ * Returns the size of the string at the byte stream offset up to and including the end of string character,
+ * the remaining size of the byte stream rounded down to a multiple of 2 if not found
+ * or 0 if the offset is out of bounds
+ */
+size_t libfwsi_string_get_utf16_stream_string_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        size_t byte_stream_offset )
+{
+#if defined( __SSE2__ )
+	__m128i zero_block       = _mm_setzero_si128();
+	__m128i block;
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	uint16x8_t block;
+
+#else
+	uint64_t value_64bit     = 0;
+
+#endif
+	size_t byte_stream_index = byte_stream_offset;
+
+	if( ( byte_stream == NULL )
+	 || ( byte_stream_offset >= byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	/* The blocks start at an even distance from the byte stream offset
+	 * so that their 16-bit values are aligned with the UTF-16 values
+	 */
+#if defined( __SSE2__ )
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		block = _mm_loadu_si128(
+		         (const __m128i *) &( byte_stream[ byte_stream_index ] ) );
+
+		if( _mm_movemask_epi8( _mm_cmpeq_epi16( block, zero_block ) ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 16;
+	}
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		block = vreinterpretq_u16_u8(
+		         vld1q_u8(
+		          &( byte_stream[ byte_stream_index ] ) ) );
+
+		if( vminvq_u16( block ) == 0 )
+		{
+			break;
+		}
+		byte_stream_index += 16;
+	}
+#else
+	while( ( byte_stream_size - byte_stream_index ) >= 8 )
+	{
+		memory_copy(
+		 &value_64bit,
+		 &( byte_stream[ byte_stream_index ] ),
+		 8 );
+
+		/* Subtracting 1 from a 0-value sets its most significant bit,
+		 * which is independent of the byte order
+		 */
+		if( ( ( value_64bit - 0x0001000100010001ULL ) & ~value_64bit & 0x8000800080008000ULL ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 8;
+	}
+#endif
+	while( ( byte_stream_index + 1 ) < byte_stream_size )
+	{
+		if( ( byte_stream[ byte_stream_index ] == 0 )
+		 && ( byte_stream[ byte_stream_index + 1 ] == 0 ) )
+		{
+			return( byte_stream_index + 2 - byte_stream_offset );
+		}
+		byte_stream_index += 2;
+	}
+	return( ( byte_stream_size - byte_stream_offset ) & ~( (size_t) 1 ) );
+}
+
+/* Determines the size of a UTF-8 string from a byte stream
+ * 7-bit ASCII strings are sized directly, other strings are sized by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_get_utf8_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_string_get_utf8_size_from_byte_stream";
+	size_t string_length  = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit ASCII characters are the same in the supported codepages and UTF-8
+	 */
+	if( byte_stream_size > 0 )
+	{
+		string_length = libfwsi_string_scan_7bit_ascii(
+		                 byte_stream,
+		                 byte_stream_size );
+
+		if( ( string_length == byte_stream_size )
+		 || ( byte_stream[ string_length ] == 0 ) )
+		{
+			*utf8_string_size = string_length + 1;
+
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_size_from_byte_stream(
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a UTF-8 string from a byte stream
+ * 7-bit ASCII strings are copied directly, other strings are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_copy_utf8_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_index = 0;
+	static char *function    = "libfwsi_string_copy_utf8_from_byte_stream";
+
+	if( libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a UTF-8 string from a byte stream at a specific index
+ * The UTF-8 string index is set to the index directly after the end of string character
+ * 7-bit ASCII strings are copied directly, other strings are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_with_index_copy_utf8_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_string_with_index_copy_utf8_from_byte_stream";
+	size_t string_length  = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* 7-bit ASCII characters are the same in the supported codepages and UTF-8
+	 */
+	if( byte_stream_size > 0 )
+	{
+		string_length = libfwsi_string_scan_7bit_ascii(
+		                 byte_stream,
+		                 byte_stream_size );
+
+		if( ( string_length == byte_stream_size )
+		 || ( byte_stream[ string_length ] == 0 ) )
+		{
+			if( ( string_length + 1 ) > ( utf8_string_size - *utf8_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( string_length > 0 )
+			{
+				if( memory_copy(
+				     &( utf8_string[ *utf8_string_index ] ),
+				     byte_stream,
+				     string_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			utf8_string[ *utf8_string_index + string_length ] = 0;
+
+			*utf8_string_index += string_length + 1;
+
+			return( 1 );
+		}
+	}
+	if( libuna_utf8_string_with_index_copy_from_byte_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a UTF-16 little-endian stream to a UTF-8 string
+ * The conversion stops at the first end of string character and combines surrogate pairs
+ * Without a UTF-8 string only the required UTF-8 string size is determined,
+ * the UTF-8 string is only completely set when the required size does not exceed its size
+ * Streams with an odd size, a byte order mark or an unpaired surrogate are not converted
+ * so that libuna can handle them
+ * Returns 1 if successful or 0 if the stream was not converted
+ */
+int libfwsi_string_convert_utf16_stream_to_utf8(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size )
+{
+#if defined( __SSE2__ )
+	__m128i non_ascii_mask     = _mm_set1_epi16( (short) 0xff80 );
+	__m128i zero_block         = _mm_setzero_si128();
+	__m128i block;
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+	uint8x16x2_t block;
+
+#endif
+	size_t utf16_stream_index  = 0;
+	size_t utf8_string_index   = 0;
+	uint32_t unicode_character = 0;
+	uint16_t utf16_surrogate   = 0;
+	uint8_t character_size     = 0;
+
+	if( ( utf16_stream == NULL )
+	 || ( required_utf8_string_size == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( utf16_stream_size >= 2 )
+	{
+		if( ( ( utf16_stream[ 0 ] == 0xff )
+		  &&  ( utf16_stream[ 1 ] == 0xfe ) )
+		 || ( ( utf16_stream[ 0 ] == 0xfe )
+		  &&  ( utf16_stream[ 1 ] == 0xff ) ) )
+		{
+			return( 0 );
+		}
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+#if defined( __SSE2__ )
+		/* Convert 8 non-zero 7-bit ASCII characters at once
+		 */
+		if( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+		{
+			block = _mm_loadu_si128(
+			         (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			if( ( _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( block, non_ascii_mask ), zero_block ) ) == 0xffff )
+			 && ( _mm_movemask_epi8( _mm_cmpeq_epi16( block, zero_block ) ) == 0 ) )
+			{
+				if( utf8_string != NULL )
+				{
+					if( ( utf8_string_size - utf8_string_index ) < 8 )
+					{
+						utf8_string = NULL;
+					}
+					else
+					{
+						_mm_storel_epi64(
+						 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+						 _mm_packus_epi16( block, block ) );
+					}
+				}
+				utf16_stream_index += 16;
+				utf8_string_index  += 8;
+
+				continue;
+			}
+		}
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+		/* Convert 16 non-zero 7-bit ASCII characters at once, the load separates
+		 * the lower and upper bytes of the UTF-16 little-endian values
+		 */
+		if( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+		{
+			block = vld2q_u8(
+			         &( utf16_stream[ utf16_stream_index ] ) );
+
+			if( ( vmaxvq_u8( block.val[ 1 ] ) == 0 )
+			 && ( vmaxvq_u8( block.val[ 0 ] ) < 0x80 )
+			 && ( vminvq_u8( block.val[ 0 ] ) != 0 ) )
+			{
+				if( utf8_string != NULL )
+				{
+					if( ( utf8_string_size - utf8_string_index ) < 16 )
+					{
+						utf8_string = NULL;
+					}
+					else
+					{
+						vst1q_u8(
+						 &( utf8_string[ utf8_string_index ] ),
+						 block.val[ 0 ] );
+					}
+				}
+				utf16_stream_index += 32;
+				utf8_string_index  += 16;
+
+				continue;
+			}
+		}
+#endif
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 unicode_character );
+
+		utf16_stream_index += 2;
+
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( ( unicode_character >= 0xd800 )
+		 && ( unicode_character <= 0xdfff ) )
+		{
+			if( ( unicode_character > 0xdbff )
+			 || ( ( utf16_stream_size - utf16_stream_index ) < 2 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 utf16_surrogate );
+
+			if( ( utf16_surrogate < 0xdc00 )
+			 || ( utf16_surrogate > 0xdfff ) )
+			{
+				return( 0 );
+			}
+			unicode_character = ( ( unicode_character - 0xd800 ) << 10 )
+			                  + ( utf16_surrogate - 0xdc00 )
+			                  + 0x00010000UL;
+
+			utf16_stream_index += 2;
+		}
+		if( unicode_character < 0x00000080UL )
+		{
+			character_size = 1;
+		}
+		else if( unicode_character < 0x00000800UL )
+		{
+			character_size = 2;
+		}
+		else if( unicode_character < 0x00010000UL )
+		{
+			character_size = 3;
+		}
+		else
+		{
+			character_size = 4;
+		}
+		if( utf8_string != NULL )
+		{
+			if( ( utf8_string_size - utf8_string_index ) < (size_t) character_size )
+			{
+				utf8_string = NULL;
+			}
+			else if( character_size == 1 )
+			{
+				utf8_string[ utf8_string_index ] = (uint8_t) unicode_character;
+			}
+			else if( character_size == 2 )
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			}
+			else if( character_size == 3 )
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			}
+			else
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+				utf8_string[ utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index + 3 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			}
+		}
+		utf8_string_index += character_size;
+	}
+	if( ( utf8_string != NULL )
+	 && ( utf8_string_index < utf8_string_size ) )
+	{
+		utf8_string[ utf8_string_index ] = 0;
+	}
+	*required_utf8_string_size = utf8_string_index + 1;
+
+	return( 1 );
+}
+
+/* Determines the size of a UTF-8 string from a UTF-16 little-endian stream
+ * Streams that are not converted by libfwsi_string_convert_utf16_stream_to_utf8 are sized by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_get_utf8_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_string_get_utf8_size_from_utf16_stream";
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size > 0 )
+	 && ( libfwsi_string_convert_utf16_stream_to_utf8(
+	       utf16_stream,
+	       utf16_stream_size,
+	       NULL,
+	       0,
+	       utf8_string_size ) == 1 ) )
+	{
+		return( 1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a UTF-8 string from a UTF-16 little-endian stream
+ * Streams that are not converted by libfwsi_string_convert_utf16_stream_to_utf8 are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_copy_utf8_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_index = 0;
+	static char *function    = "libfwsi_string_copy_utf8_from_utf16_stream";
+
+	if( libfwsi_string_with_index_copy_utf8_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a UTF-8 string from a UTF-16 little-endian stream at a specific index
+ * The UTF-8 string index is set to the index directly after the end of string character
+ * Streams that are not converted by libfwsi_string_convert_utf16_stream_to_utf8 are converted by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_with_index_copy_utf8_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfwsi_string_with_index_copy_utf8_from_utf16_stream";
+	size_t required_utf8_string_size = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size > 0 )
+	 && ( libfwsi_string_convert_utf16_stream_to_utf8(
+	       utf16_stream,
+	       utf16_stream_size,
+	       &( utf8_string[ *utf8_string_index ] ),
+	       utf8_string_size - *utf8_string_index,
+	       &required_utf8_string_size ) == 1 ) )
+	{
+		if( required_utf8_string_size > ( utf8_string_size - *utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_index += required_utf8_string_size;
+
+		return( 1 );
+	}
+	if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a byte stream or UTF-16 little-endian stream string to a UTF-8 string
+ * UTF-16 little-endian streams and 7-bit ASCII strings are converted directly,
+ * other strings are converted once by libuna and the size is only determined
+ * separately when the conversion does not fit
+ * The required UTF-8 string size includes the end of string character and is always set,
+ * the UTF-8 string is only set when the required size does not exceed its size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_copy_to_utf8(
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *copy_error = NULL;
+	static char *function         = "libfwsi_string_copy_to_utf8";
+	size_t string_length          = 0;
+	size_t utf8_string_index      = 0;
+	uint8_t is_ascii              = 1;
+	int result                    = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_type != LIBFWSI_STRING_TYPE_BYTE_STREAM )
+	 && ( string_type != LIBFWSI_STRING_TYPE_UTF16_STREAM ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+	{
+		if( libfwsi_string_convert_utf16_stream_to_utf8(
+		     string,
+		     string_size,
+		     utf8_string,
+		     utf8_string_size,
+		     required_utf8_string_size ) == 1 )
+		{
+			return( 1 );
+		}
+		is_ascii = 0;
+	}
+	else
+	{
+		/* 7-bit ASCII characters are the same in the supported codepages and UTF-8
+		 */
+		string_length = libfwsi_string_scan_7bit_ascii(
+		                 string,
+		                 string_size );
+
+		if( ( string_length < string_size )
+		 && ( string[ string_length ] != 0 ) )
+		{
+			is_ascii = 0;
+		}
+	}
+	if( is_ascii != 0 )
+	{
+		*required_utf8_string_size = string_length + 1;
+
+		if( *required_utf8_string_size > utf8_string_size )
+		{
+			return( 1 );
+		}
+		if( string_length > 0 )
+		{
+			if( memory_copy(
+			     utf8_string,
+			     string,
+			     string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		utf8_string[ string_length ] = 0;
+
+		return( 1 );
+	}
+	/* Convert directly since the UTF-8 string is commonly large enough
+	 */
+	if( utf8_string_size > 0 )
+	{
+		if( string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+		{
+			result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+			          utf8_string,
+			          utf8_string_size,
+			          &utf8_string_index,
+			          string,
+			          string_size,
+			          LIBUNA_ENDIAN_LITTLE,
+			          &copy_error );
+		}
+		else
+		{
+			result = libuna_utf8_string_with_index_copy_from_byte_stream(
+			          utf8_string,
+			          utf8_string_size,
+			          &utf8_string_index,
+			          string,
+			          string_size,
+			          ascii_codepage,
+			          &copy_error );
+		}
+		if( result == 1 )
+		{
+			*required_utf8_string_size = utf8_string_index;
+
+			return( 1 );
+		}
+		libcerror_error_free(
+		 &copy_error );
+	}
+	if( string_type == LIBFWSI_STRING_TYPE_UTF16_STREAM )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          string,
+		          string_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          required_utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf8_string_size_from_byte_stream(
+		          string,
+		          string_size,
+		          ascii_codepage,
+		          required_utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *required_utf8_string_size <= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a string cache
+ * The strings of a string cache allocated from an arena are released with the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_cache_free(
+     libfwsi_string_cache_t **string_cache,
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_string_cache_free";
+	int string_index      = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_cache != NULL )
+	{
+		if( arena == NULL )
+		{
+			for( string_index = 0;
+			     string_index < LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS;
+			     string_index++ )
+			{
+				if( ( *string_cache )->utf8_strings[ string_index ] != NULL )
+				{
+					memory_free(
+					 ( *string_cache )->utf8_strings[ string_index ] );
+				}
+			}
+			memory_free(
+			 *string_cache );
+		}
+		*string_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves a UTF-8 string from a string cache
+ * The string is converted and stored in the string cache when it is first retrieved,
+ * the string cache is created when needed and allocated from the arena if set
+ * The UTF-8 string remains valid until the string cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_cache_get_utf8_string(
+     libfwsi_string_cache_t **string_cache,
+     libfwsi_arena_t *arena,
+     int string_index,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     int ascii_codepage,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t conversion_buffer[ LIBFWSI_STRING_CACHE_CONVERSION_BUFFER_SIZE ];
+
+	uint8_t *cached_utf8_string = NULL;
+	static char *function       = "libfwsi_string_cache_get_utf8_string";
+	size_t cached_utf8_size     = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_cache == NULL )
+	{
+		if( libfwsi_arena_allocate(
+		     arena,
+		     sizeof( libfwsi_string_cache_t ),
+		     (void **) string_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     *string_cache,
+		     0,
+		     sizeof( libfwsi_string_cache_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear string cache.",
+			 function );
+
+			/* The string cache is not initialized and cannot be passed to libfwsi_string_cache_free
+			 */
+			if( arena == NULL )
+			{
+				memory_free(
+				 *string_cache );
+			}
+			*string_cache = NULL;
+
+			return( -1 );
+		}
+	}
+	if( ( *string_cache )->utf8_strings[ string_index ] == NULL )
+	{
+		/* Most strings fit in the conversion buffer, which allows the cached string
+		 * to be allocated with the exact size after a single conversion
+		 */
+		if( libfwsi_string_copy_to_utf8(
+		     string,
+		     string_size,
+		     string_type,
+		     ascii_codepage,
+		     conversion_buffer,
+		     LIBFWSI_STRING_CACHE_CONVERSION_BUFFER_SIZE,
+		     &cached_utf8_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwsi_arena_allocate(
+		     arena,
+		     cached_utf8_size,
+		     (void **) &cached_utf8_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( cached_utf8_size <= LIBFWSI_STRING_CACHE_CONVERSION_BUFFER_SIZE )
+		{
+			if( memory_copy(
+			     cached_utf8_string,
+			     conversion_buffer,
+			     cached_utf8_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( libfwsi_string_copy_to_utf8(
+		          string,
+		          string_size,
+		          string_type,
+		          ascii_codepage,
+		          cached_utf8_string,
+		          cached_utf8_size,
+		          &cached_utf8_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		( *string_cache )->utf8_strings[ string_index ]      = cached_utf8_string;
+		( *string_cache )->utf8_string_sizes[ string_index ] = cached_utf8_size;
+	}
+	*utf8_string      = ( *string_cache )->utf8_strings[ string_index ];
+	*utf8_string_size = ( *string_cache )->utf8_string_sizes[ string_index ];
+
+	return( 1 );
+
+on_error:
+	if( ( arena == NULL )
+	 && ( cached_utf8_string != NULL ) )
+	{
+		memory_free(
+		 cached_utf8_string );
+	}
+	return( -1 );
+}
+
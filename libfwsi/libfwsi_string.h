@@ -0,0 +1,162 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_STRING_H )
+#define _LIBFWSI_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_arena.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The string types
+ */
+enum LIBFWSI_STRING_TYPES
+{
+	LIBFWSI_STRING_TYPE_BYTE_STREAM		= 1,
+	LIBFWSI_STRING_TYPE_UTF16_STREAM	= 2
+};
+
+/* The maximum number of strings in a string cache
+ */
+#define LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS		3
+
+/* The size of the buffer the strings of a string cache are first converted into
+ */
+#define LIBFWSI_STRING_CACHE_CONVERSION_BUFFER_SIZE	256
+
+typedef struct libfwsi_string_cache libfwsi_string_cache_t;
+
+struct libfwsi_string_cache
+{
+	/* The UTF-8 strings
+	 */
+	uint8_t *utf8_strings[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+
+	/* The UTF-8 string sizes
+	 */
+	size_t utf8_string_sizes[ LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS ];
+};
+
+size_t libfwsi_string_scan_7bit_ascii(
+        const uint8_t *string,
+        size_t string_size );
+
+size_t libfwsi_string_get_byte_stream_string_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        size_t byte_stream_offset );
+
+size_t libfwsi_string_get_utf16_stream_string_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        size_t byte_stream_offset );
+
+int libfwsi_string_get_utf8_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_copy_utf8_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwsi_string_with_index_copy_utf8_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwsi_string_convert_utf16_stream_to_utf8(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size );
+
+int libfwsi_string_get_utf8_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_copy_utf8_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_with_index_copy_utf8_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_copy_to_utf8(
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_cache_free(
+     libfwsi_string_cache_t **string_cache,
+     libfwsi_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwsi_string_cache_get_utf8_string(
+     libfwsi_string_cache_t **string_cache,
+     libfwsi_arena_t *arena,
+     int string_index,
+     const uint8_t *string,
+     size_t string_size,
+     int string_type,
+     int ascii_codepage,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_STRING_H ) */
+
@@ -34,14 +34,20 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwsi_batch {}			libfwsi_batch_t;
 typedef struct libfwsi_extension_block {}	libfwsi_extension_block_t;
 typedef struct libfwsi_item {}			libfwsi_item_t;
 typedef struct libfwsi_item_list {}		libfwsi_item_list_t;
+typedef struct libfwsi_scanner {}		libfwsi_scanner_t;
+typedef struct libfwsi_stream_parser {}	libfwsi_stream_parser_t;
 
 #else
+typedef intptr_t libfwsi_batch_t;
 typedef intptr_t libfwsi_extension_block_t;
 typedef intptr_t libfwsi_item_t;
 typedef intptr_t libfwsi_item_list_t;
+typedef intptr_t libfwsi_scanner_t;
+typedef intptr_t libfwsi_stream_parser_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -31,6 +31,7 @@
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libfguid.h"
 #include "libfwsi_shell_folder_identifier.h"
+#include "libfwsi_string.h"
 #include "libfwsi_unknown_0x74_values.h"
 
 /* Creates unknown 0x74 values
@@ -337,18 +338,10 @@ ssize_t libfwsi_unknown_0x74_values_read(
 #endif
 		shell_item_data_offset += 12;
 
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size++ )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size++;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 
 		string_alignment_size = string_size % 2;
 
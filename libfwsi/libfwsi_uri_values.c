@@ -29,6 +29,7 @@
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 #include "libfwsi_uri_values.h"
 
 /* Creates URI values
@@ -371,34 +372,17 @@ ssize_t libfwsi_uri_values_read(
 	 */
 	if( ( flags & 0x80 ) != 0 )
 	{
-		for( string_size = shell_item_data_offset;
-		     ( string_size + 1 ) < shell_item_data_size;
-		     string_size += 2 )
-		{
-			if( ( shell_item_data[ string_size ] == 0 )
-			 && ( shell_item_data[ string_size + 1 ] == 0 ) )
-			{
-				string_size += 2;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 	}
 	else
 	{
-		for( string_size = shell_item_data_offset;
-		     string_size < shell_item_data_size;
-		     string_size++ )
-		{
-			if( shell_item_data[ string_size ] == 0 )
-			{
-				string_size++;
-
-				break;
-			}
-		}
-		string_size -= shell_item_data_offset;
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		              shell_item_data,
+		              shell_item_data_size,
+		              shell_item_data_offset );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -313,8 +313,25 @@ ssize_t libfwsi_users_property_view_values_read(
 			break;
 
 		case 0x23febbeeUL:
-			if( identifier_size == 16 )
+			if( ( identifier_size == 16 )
+			 && ( ( shell_item_data_size - shell_item_data_offset ) >= 16 ) )
 			{
+				if( memory_copy(
+				     users_property_view_values->known_folder_identifier,
+				     &( shell_item_data[ shell_item_data_offset ] ),
+				     16 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy known folder identifier.",
+					 function );
+
+					return( -1 );
+				}
+				users_property_view_values->has_known_folder_identifier = 1;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
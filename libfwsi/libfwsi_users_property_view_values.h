@@ -35,9 +35,13 @@ typedef struct libfwsi_users_property_view_values libfwsi_users_property_view_va
 
 struct libfwsi_users_property_view_values
 {
-	/* Dummy
+	/* The known folder identifier
 	 */
-	int dummy;
+	uint8_t known_folder_identifier[ 16 ];
+
+	/* Value to indicate the known folder identifier is set
+	 */
+	uint8_t has_known_folder_identifier;
 };
 
 int libfwsi_users_property_view_values_initialize(
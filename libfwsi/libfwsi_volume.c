@@ -27,6 +27,7 @@
 #include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 #include "libfwsi_volume.h"
 #include "libfwsi_volume_values.h"
 
@@ -79,7 +80,7 @@ int libfwsi_volume_get_utf8_name_size(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_get_utf8_size_from_byte_stream(
 	     volume_values->name,
 	     volume_values->name_size,
 	     volume_values->ascii_codepage,
@@ -148,7 +149,7 @@ int libfwsi_volume_get_utf8_name(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_copy_utf8_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     volume_values->name,
@@ -168,6 +169,195 @@ int libfwsi_volume_get_utf8_name(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 formatted name and its size in a single conversion
+ * The size includes the end of string character and is also set when the UTF-8 string is too small,
+ * in which case 0 is returned without an error, a NULL UTF-8 string with a size of 0 only retrieves the size
+ * Returns 1 if successful, 0 if the UTF-8 string is too small or -1 on error
+ */
+int libfwsi_volume_get_utf8_name_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_name_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_volume_values_t *volume_values = NULL;
+	static char *function                  = "libfwsi_volume_get_utf8_name_and_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	volume_values = (libfwsi_volume_values_t *) internal_item->value;
+
+	if( utf8_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_string_copy_to_utf8(
+	     volume_values->name,
+	     volume_values->name_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     volume_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string != NULL )
+	 && ( *utf8_name_size > utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted name from the string cache of the item
+ * The UTF-8 string is converted when first retrieved and remains valid until the item is freed or cleared,
+ * the string cache is not safe to access from multiple threads concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_volume_get_cached_utf8_name(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_volume_values_t *volume_values = NULL;
+	static char *function                  = "libfwsi_volume_get_cached_utf8_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	volume_values = (libfwsi_volume_values_t *) internal_item->value;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_string_cache_get_utf8_string(
+	     &( internal_item->string_cache ),
+	     internal_item->arena,
+	     LIBFWSI_VOLUME_STRING_CACHE_INDEX_NAME,
+	     volume_values->name,
+	     volume_values->name_size,
+	     LIBFWSI_STRING_TYPE_BYTE_STREAM,
+	     volume_values->ascii_codepage,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string from string cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 formatted name
  * Returns 1 if successful or -1 on error
  */
@@ -33,6 +33,13 @@
 extern "C" {
 #endif
 
+/* The indexes of the strings in the string cache of a volume
+ */
+enum LIBFWSI_VOLUME_STRING_CACHE_INDEXES
+{
+	LIBFWSI_VOLUME_STRING_CACHE_INDEX_NAME	= 0
+};
+
 LIBFWSI_EXTERN \
 int libfwsi_volume_get_utf8_name_size(
      libfwsi_item_t *item,
@@ -46,6 +53,21 @@ int libfwsi_volume_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_volume_get_utf8_name_and_size(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_name_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_volume_get_cached_utf8_name(
+     libfwsi_item_t *item,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_volume_get_utf16_name_size(
      libfwsi_item_t *item,
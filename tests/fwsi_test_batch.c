@@ -0,0 +1,1078 @@
+/*
+ * Library batch type testing program
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+uint8_t fwsi_test_batch_data1[ 127 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_batch_t *batch   = NULL;
+	int result               = 0;
+
+	/* Test libfwsi_batch_initialize
+	 */
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "batch",
+         batch );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libfwsi_batch_free(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "batch",
+         batch );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_batch_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (libfwsi_batch_t *) 0x12345678UL;
+
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	/* Test libfwsi_batch_initialize with malloc failing
+	 */
+	fwsi_test_malloc_attempts_before_fail = 0;
+
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	if( fwsi_test_malloc_attempts_before_fail != -1 )
+	{
+		fwsi_test_malloc_attempts_before_fail = -1;
+
+		if( batch != NULL )
+		{
+			libfwsi_batch_free(
+			 &batch,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "batch",
+		 batch );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfwsi_batch_initialize with memset failing
+	 */
+	fwsi_test_memset_attempts_before_fail = 0;
+
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	if( fwsi_test_memset_attempts_before_fail != -1 )
+	{
+		fwsi_test_memset_attempts_before_fail = -1;
+
+		if( batch != NULL )
+		{
+			libfwsi_batch_free(
+			 &batch,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "batch",
+		 batch );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libfwsi_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_batch_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfwsi_batch_set_parse_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_set_parse_flags(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_batch_t *batch   = NULL;
+	uint32_t parse_flags     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_batch_set_parse_flags(
+	          batch,
+	          LIBFWSI_PARSE_FLAG_USE_ARENA,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libfwsi_batch_get_parse_flags(
+	          batch,
+	          &parse_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "parse_flags",
+	 parse_flags,
+	 (uint32_t) LIBFWSI_PARSE_FLAG_USE_ARENA );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_batch_set_parse_flags(
+	          NULL,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_batch_set_parse_flags(
+	          batch,
+	          0x80000000UL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_batch_free(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libfwsi_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_batch_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_set_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_batch_t *batch   = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_batch_set_number_of_threads(
+	          batch,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_batch_get_number_of_threads(
+	          batch,
+	          &number_of_threads,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 4 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_batch_set_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_batch_set_number_of_threads(
+	          batch,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_batch_free(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libfwsi_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_batch_copy_from_byte_streams function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_copy_from_byte_streams(
+     void )
+{
+	const uint8_t *byte_streams[ 3 ] = {
+		fwsi_test_batch_data1,
+		fwsi_test_batch_data1,
+		fwsi_test_batch_data1 };
+
+	size_t byte_stream_sizes[ 3 ] = {
+		127,
+		100,
+		127 };
+
+	uint32_t parse_flags_values[ 3 ] = {
+		0,
+		LIBFWSI_PARSE_FLAG_USE_ARENA,
+		LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_USE_ARENA };
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_batch_t *batch         = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t parse_error_offset      = 0;
+	int entry_index                = 0;
+	int iterator                   = 0;
+	int number_of_entries          = 0;
+	int number_of_items            = 0;
+	int parse_error                = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( parse_flags_index = 0;
+	     parse_flags_index < 3;
+	     parse_flags_index++ )
+	{
+		result = libfwsi_batch_set_parse_flags(
+		          batch,
+		          parse_flags_values[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Copy twice to test reuse of the item lists of the previous batch
+		 */
+		for( iterator = 0;
+		     iterator < 2;
+		     iterator++ )
+		{
+			result = libfwsi_batch_copy_from_byte_streams(
+			          batch,
+			          byte_streams,
+			          byte_stream_sizes,
+			          3,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_batch_get_number_of_entries(
+			          batch,
+			          &number_of_entries,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_entries",
+			 number_of_entries,
+			 3 );
+
+			for( entry_index = 0;
+			     entry_index < 3;
+			     entry_index++ )
+			{
+				result = libfwsi_batch_get_parse_error(
+				          batch,
+				          entry_index,
+				          &parse_error,
+				          &parse_error_offset,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				result = libfwsi_batch_get_item_list(
+				          batch,
+				          entry_index,
+				          &item_list,
+				          &error );
+
+				if( entry_index == 1 )
+				{
+					FWSI_TEST_ASSERT_EQUAL_INT(
+					 "parse_error",
+					 parse_error,
+					 LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS );
+
+					FWSI_TEST_ASSERT_EQUAL_SIZE(
+					 "parse_error_offset",
+					 parse_error_offset,
+					 (size_t) 45 );
+
+					FWSI_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 0 );
+
+					FWSI_TEST_ASSERT_IS_NULL(
+					 "item_list",
+					 item_list );
+
+					continue;
+				}
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "parse_error",
+				 parse_error,
+				 LIBFWSI_PARSE_ERROR_NONE );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FWSI_TEST_ASSERT_IS_NOT_NULL(
+				 "item_list",
+				 item_list );
+
+				result = libfwsi_item_list_get_number_of_items(
+				          item_list,
+				          &number_of_items,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "number_of_items",
+				 number_of_items,
+				 3 );
+
+				result = libfwsi_item_list_free(
+				          &item_list,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_batch_copy_from_byte_streams(
+	          NULL,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_batch_copy_from_byte_streams(
+	          batch,
+	          NULL,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_batch_copy_from_byte_streams(
+	          batch,
+	          byte_streams,
+	          byte_stream_sizes,
+	          -1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_batch_copy_from_byte_streams(
+	          batch,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          -1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_batch_free(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( batch != NULL )
+	{
+		libfwsi_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_batch_copy_from_byte_streams function using multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_batch_copy_from_byte_streams_multi_threaded(
+     void )
+{
+	const uint8_t *byte_streams[ 1024 ];
+	size_t byte_stream_sizes[ 1024 ];
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_batch_t *batch         = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t parse_error_offset      = 0;
+	int entry_index                = 0;
+	int number_of_entries          = 0;
+	int number_of_items            = 0;
+	int parse_error                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	for( entry_index = 0;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		byte_streams[ entry_index ] = fwsi_test_batch_data1;
+
+		if( ( entry_index % 3 ) == 1 )
+		{
+			byte_stream_sizes[ entry_index ] = 100;
+		}
+		else
+		{
+			byte_stream_sizes[ entry_index ] = 127;
+		}
+	}
+	result = libfwsi_batch_initialize(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_batch_set_parse_flags(
+	          batch,
+	          LIBFWSI_PARSE_FLAG_USE_ARENA,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_batch_set_number_of_threads(
+	          batch,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_batch_copy_from_byte_streams(
+	          batch,
+	          byte_streams,
+	          byte_stream_sizes,
+	          1024,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_batch_get_number_of_entries(
+	          batch,
+	          &number_of_entries,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1024 );
+
+	/* The results are in input order
+	 */
+	for( entry_index = 0;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		result = libfwsi_batch_get_parse_error(
+		          batch,
+		          entry_index,
+		          &parse_error,
+		          &parse_error_offset,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( ( entry_index % 3 ) == 1 )
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "parse_error",
+			 parse_error,
+			 LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS );
+
+			continue;
+		}
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "parse_error",
+		 parse_error,
+		 LIBFWSI_PARSE_ERROR_NONE );
+
+		result = libfwsi_batch_get_item_list(
+		          batch,
+		          entry_index,
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libfwsi_batch_free(
+	          &batch,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( batch != NULL )
+	{
+		libfwsi_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_initialize",
+	 fwsi_test_batch_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_free",
+	 fwsi_test_batch_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_set_parse_flags",
+	 fwsi_test_batch_set_parse_flags );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_set_number_of_threads",
+	 fwsi_test_batch_set_number_of_threads );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_copy_from_byte_streams",
+	 fwsi_test_batch_copy_from_byte_streams );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_batch_copy_from_byte_streams (multi-threaded)",
+	 fwsi_test_batch_copy_from_byte_streams_multi_threaded );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
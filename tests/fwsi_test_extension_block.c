@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,17 @@
 #include "fwsi_test_memory.h"
 #include "fwsi_test_unused.h"
 
+#include "../libfwsi/libfwsi_extension_block.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+uint8_t fwsi_test_extension_block_data1[ 44 ] = {
+	0x0e, 0x00, 0x01, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+	0x01, 0x00, 0x19, 0x00, 0xef, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x00,
+	0x25, 0x00, 0xef, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
 /* Tests the libfwsi_extension_block_free function
  * Returns 1 if successful or 0 if not
  */
@@ -71,6 +83,123 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_extension_blocks_count function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_extension_blocks_count(
+     void )
+{
+	uint8_t byte_stream[ 44 ];
+
+	int number_of_extension_blocks = 0;
+
+	/* Test regular cases
+	 */
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              fwsi_test_extension_block_data1,
+	                              44 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 3 );
+
+	/* Test a single extension block
+	 */
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              fwsi_test_extension_block_data1,
+	                              14 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	/* Test a byte stream without extension blocks
+	 */
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              fwsi_test_extension_block_data1,
+	                              0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 0 );
+
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              fwsi_test_extension_block_data1,
+	                              2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 0 );
+
+	/* Test that the count ends at an extension block size value that is out of bounds
+	 */
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              fwsi_test_extension_block_data1,
+	                              41 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 2 );
+
+	/* Test that the count ends at an extension block size value that is too small
+	 * or at an extension block without the 0xbeef signature prefix
+	 */
+	if( memory_copy(
+	     byte_stream,
+	     fwsi_test_extension_block_data1,
+	     44 ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream[ 14 ] = 0x09;
+
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              byte_stream,
+	                              44 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	byte_stream[ 14 ] = 0x0e;
+	byte_stream[ 21 ] = 0x00;
+
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              byte_stream,
+	                              44 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	/* Test error cases
+	 */
+	number_of_extension_blocks = libfwsi_extension_blocks_count(
+	                              NULL,
+	                              44 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -90,6 +219,14 @@ int main(
 	 "libfwsi_extension_block_free",
 	 fwsi_test_extension_block_free );
 
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_extension_blocks_count",
+	 fwsi_test_extension_blocks_count );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
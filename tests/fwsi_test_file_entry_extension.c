@@ -0,0 +1,2770 @@
+/*
+ * Library file entry extension functions type testing program
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+uint8_t fwsi_test_file_entry_extension_data1[ 104 ] = {
+	0x68, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69,
+	0x72, 0x30, 0x00, 0x00, 0x52, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11,
+	0x22, 0x22, 0x22, 0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x44, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x6f, 0x00,
+	0x72, 0x00, 0x79, 0x00, 0x30, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x61, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_item_list_data1[ 106 ] = {
+	0x68, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69,
+	0x72, 0x30, 0x00, 0x00, 0x52, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11,
+	0x22, 0x22, 0x22, 0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x44, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x6f, 0x00,
+	0x72, 0x00, 0x79, 0x00, 0x30, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x61, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data2[ 134 ] = {
+	0x86, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x74, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00,
+	0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00,
+	0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00,
+	0x5a, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x00, 0x00, 0x4c, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data3[ 136 ] = {
+	0x88, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x76, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00,
+	0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00,
+	0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00,
+	0x5a, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data4[ 102 ] = {
+	0x66, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x54, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00,
+	0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00,
+	0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data5[ 104 ] = {
+	0x68, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x56, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00,
+	0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00,
+	0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data6[ 76 ] = {
+	0x4c, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x3a, 0x00, 0x03, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+	0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5a, 0x61, 0x62, 0x63, 0x64, 0x65, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_file_entry_extension_data7[ 77 ] = {
+	0x4d, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x00,
+	0x3b, 0x00, 0x03, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x14, 0x00, 0x21, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+	0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5a, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_long_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_long_name_size(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name_size(
+	          extension_block,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_long_name_size(
+	          extension_block,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_long_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_long_name(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Directory0",
+	          11 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name(
+	          NULL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_long_name(
+	          extension_block,
+	          NULL,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_long_name(
+	          extension_block,
+	          utf8_string,
+	          10,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_long_name_and_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_long_name_and_size(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Directory0",
+	          11 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test retrieving only the size
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+	          extension_block,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+	          NULL,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a UTF-8 string that is 1 byte too small, the size is still set without an error
+	 */
+	utf8_string_size = 0;
+
+	result = libfwsi_file_entry_extension_get_utf8_long_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          10,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_localized_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_localized_name_size(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_size(
+	          extension_block,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_size(
+	          extension_block,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_localized_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_localized_name(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Local",
+	          6 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name(
+	          NULL,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_localized_name(
+	          extension_block,
+	          NULL,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_localized_name(
+	          extension_block,
+	          utf8_string,
+	          5,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_localized_name_and_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_localized_name_and_size(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Local",
+	          6 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test retrieving only the size
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+	          extension_block,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+	          NULL,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          64,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a UTF-8 string that is 1 byte too small, the size is still set without an error
+	 */
+	utf8_string_size = 0;
+
+	result = libfwsi_file_entry_extension_get_utf8_localized_name_and_size(
+	          extension_block,
+	          utf8_string,
+	          5,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_cached_utf8_long_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_cached_utf8_long_name(
+     void )
+{
+	const uint8_t *first_utf8_string           = NULL;
+	const uint8_t *utf8_string                 = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          extension_block,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Directory0",
+	          11 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a second call returns the string stored in the string cache
+	 */
+	first_utf8_string = utf8_string;
+	utf8_string       = NULL;
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          extension_block,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string == first_utf8_string",
+	 (int) ( utf8_string == first_utf8_string ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          extension_block,
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+	          extension_block,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up, which releases the string cache
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_cached_utf8_localized_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_cached_utf8_localized_name(
+     void )
+{
+	const uint8_t *first_utf8_string           = NULL;
+	const uint8_t *utf8_string                 = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_file_entry_extension_data1,
+	          104,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+	          extension_block,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Local",
+	          6 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a second call returns the string stored in the string cache
+	 */
+	first_utf8_string = utf8_string;
+	utf8_string       = NULL;
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+	          extension_block,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string == first_utf8_string",
+	 (int) ( utf8_string == first_utf8_string ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+	          extension_block,
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+	          extension_block,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up, which releases the string cache
+	 */
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_cached_utf8_* functions on an item parsed with LIBFWSI_PARSE_FLAG_BORROW_DATA
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_cached_utf8_string_with_borrowed_data(
+     void )
+{
+	int parse_flags[ 2 ] = {
+		LIBFWSI_PARSE_FLAG_BORROW_DATA,
+		LIBFWSI_PARSE_FLAG_BORROW_DATA | LIBFWSI_PARSE_FLAG_USE_ARENA };
+
+	const uint8_t *utf8_string                 = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	libfwsi_item_list_t *item_list             = NULL;
+	size_t utf8_string_size                    = 0;
+	int parse_flags_index                      = 0;
+	int result                                 = 0;
+	int test_iteration                         = 0;
+
+	for( parse_flags_index = 0;
+	     parse_flags_index < 2;
+	     parse_flags_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_parse_flags(
+		          item_list,
+		          parse_flags[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases, the string caches are released by libfwsi_item_list_clear
+		 * in the first iteration and by libfwsi_item_list_free afterwards
+		 */
+		for( test_iteration = 0;
+		     test_iteration < 2;
+		     test_iteration++ )
+		{
+			result = libfwsi_item_list_copy_from_byte_stream(
+			          item_list,
+			          fwsi_test_file_entry_extension_item_list_data1,
+			          106,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_item(
+			          item_list,
+			          0,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_extension_block(
+			          item,
+			          0,
+			          &extension_block,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "extension_block",
+			 extension_block );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_file_entry_extension_get_cached_utf8_long_name(
+			          extension_block,
+			          &utf8_string,
+			          &utf8_string_size,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "utf8_string",
+			 utf8_string );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 (size_t) 11 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_string,
+			          "Directory0",
+			          11 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = libfwsi_file_entry_extension_get_cached_utf8_localized_name(
+			          extension_block,
+			          &utf8_string,
+			          &utf8_string_size,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "utf8_string",
+			 utf8_string );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 (size_t) 6 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          utf8_string,
+			          "Local",
+			          6 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = libfwsi_extension_block_free(
+			          &extension_block,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( test_iteration == 0 )
+			{
+				result = libfwsi_item_list_clear(
+				          item_list,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FWSI_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+		/* Clean up
+		 */
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_long_name function with a long name of exactly the inline long name size and of 2 bytes more
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_long_name_inline_size(
+     void )
+{
+	uint8_t *item_data[ 2 ] = {
+		fwsi_test_file_entry_extension_data2,
+		fwsi_test_file_entry_extension_data3 };
+
+	size_t item_data_size[ 2 ] = {
+		134,
+		136 };
+
+	const char *expected_utf8_string[ 2 ] = {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcde",
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef" };
+
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+	int test_index                             = 0;
+
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_initialize(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_copy_from_byte_stream(
+		          item,
+		          item_data[ test_index ],
+		          item_data_size[ test_index ],
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_extension_block(
+		          item,
+		          0,
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfwsi_file_entry_extension_get_utf8_long_name_size(
+		          extension_block,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) ( 32 + test_index ) );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_file_entry_extension_get_utf8_long_name(
+		          extension_block,
+		          utf8_string,
+		          128,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string[ test_index ],
+		          utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Clean up
+		 */
+		result = libfwsi_extension_block_free(
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_free(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_localized_name function with a version 9 localized name of exactly the inline localized name size and of 2 bytes more
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_localized_name_inline_size(
+     void )
+{
+	uint8_t *item_data[ 2 ] = {
+		fwsi_test_file_entry_extension_data4,
+		fwsi_test_file_entry_extension_data5 };
+
+	size_t item_data_size[ 2 ] = {
+		102,
+		104 };
+
+	const char *expected_utf8_string[ 2 ] = {
+		"ABCDEFGHIJKLMNO",
+		"ABCDEFGHIJKLMNOP" };
+
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+	int test_index                             = 0;
+
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_initialize(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_copy_from_byte_stream(
+		          item,
+		          item_data[ test_index ],
+		          item_data_size[ test_index ],
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_extension_block(
+		          item,
+		          0,
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfwsi_file_entry_extension_get_utf8_localized_name_size(
+		          extension_block,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) ( 16 + test_index ) );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_file_entry_extension_get_utf8_localized_name(
+		          extension_block,
+		          utf8_string,
+		          128,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string[ test_index ],
+		          utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Clean up
+		 */
+		result = libfwsi_extension_block_free(
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_free(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_file_entry_extension_get_utf8_localized_name function with a version 3 localized name of exactly the inline localized name size and of 1 byte more
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_file_entry_extension_get_utf8_localized_name_version3_inline_size(
+     void )
+{
+	uint8_t *item_data[ 2 ] = {
+		fwsi_test_file_entry_extension_data6,
+		fwsi_test_file_entry_extension_data7 };
+
+	size_t item_data_size[ 2 ] = {
+		76,
+		77 };
+
+	const char *expected_utf8_string[ 2 ] = {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcde",
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef" };
+
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	size_t utf8_string_size                    = 0;
+	int result                                 = 0;
+	int test_index                             = 0;
+
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_initialize(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_copy_from_byte_stream(
+		          item,
+		          item_data[ test_index ],
+		          item_data_size[ test_index ],
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_extension_block(
+		          item,
+		          0,
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfwsi_file_entry_extension_get_utf8_localized_name_size(
+		          extension_block,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) ( 32 + test_index ) );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_file_entry_extension_get_utf8_localized_name(
+		          extension_block,
+		          utf8_string,
+		          128,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string[ test_index ],
+		          utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Clean up
+		 */
+		result = libfwsi_extension_block_free(
+		          &extension_block,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "extension_block",
+		 extension_block );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_free(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_long_name_size",
+	 fwsi_test_file_entry_extension_get_utf8_long_name_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_long_name",
+	 fwsi_test_file_entry_extension_get_utf8_long_name );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_long_name_and_size",
+	 fwsi_test_file_entry_extension_get_utf8_long_name_and_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_localized_name_size",
+	 fwsi_test_file_entry_extension_get_utf8_localized_name_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_localized_name",
+	 fwsi_test_file_entry_extension_get_utf8_localized_name );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_localized_name_and_size",
+	 fwsi_test_file_entry_extension_get_utf8_localized_name_and_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_cached_utf8_long_name",
+	 fwsi_test_file_entry_extension_get_cached_utf8_long_name );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_cached_utf8_localized_name",
+	 fwsi_test_file_entry_extension_get_cached_utf8_localized_name );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_cached_utf8_string_with_borrowed_data",
+	 fwsi_test_file_entry_extension_get_cached_utf8_string_with_borrowed_data );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_long_name",
+	 fwsi_test_file_entry_extension_get_utf8_long_name_inline_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_localized_name",
+	 fwsi_test_file_entry_extension_get_utf8_localized_name_inline_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_file_entry_extension_get_utf8_localized_name",
+	 fwsi_test_file_entry_extension_get_utf8_localized_name_version3_inline_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,57 @@
 #include "fwsi_test_memory.h"
 #include "fwsi_test_unused.h"
 
+#include "../libfwsi/libfwsi_item.h"
+
+uint8_t fwsi_test_item_list_data1[ 127 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_item_list_data2[ 133 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x06, 0x00, 0x61,
+	0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_item_list_data3[ 131 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x40, 0x00, 0x31,
+	0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_item_list_data4[ 236 ] = {
+	0x16, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69,
+	0x72, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56,
+	0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x31, 0x00, 0x00, 0x46, 0x00, 0x09, 0x00, 0x04, 0x00,
+	0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00,
+	0x63, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x79, 0x00, 0x31, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00,
+	0x44, 0x69, 0x72, 0x33, 0x00, 0x00, 0x46, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11,
+	0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00,
+	0x6f, 0x00, 0x72, 0x00, 0x79, 0x00, 0x33, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x01, 0x00,
+	0x19, 0x00, 0xef, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x25, 0x00,
+	0xef, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 /* Tests the libfwsi_item_list_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -250,28 +302,4420 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libfwsi_item_list_clear function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fwsi_test_item_list_clear(
+     void )
 {
-	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
-	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+	uint32_t parse_flags[ 4 ]      = {
+		0,
+		LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_USE_ARENA,
+		LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION,
+		LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_SINGLE_ALLOCATION };
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int item_type                  = 0;
+	int number_of_items            = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+	int test_iteration             = 0;
 
-	FWSI_TEST_RUN(
-	 "libfwsi_item_list_initialize",
-	 fwsi_test_item_list_initialize );
+	for( parse_flags_index = 0;
+	     parse_flags_index < 4;
+	     parse_flags_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
 
-	FWSI_TEST_RUN(
-	 "libfwsi_item_list_free",
-	 fwsi_test_item_list_free );
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_parse_flags(
+		          item_list,
+		          parse_flags[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		for( test_iteration = 0;
+		     test_iteration < 2;
+		     test_iteration++ )
+		{
+			result = libfwsi_item_list_copy_from_byte_stream(
+			          item_list,
+			          fwsi_test_item_list_data1,
+			          127,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_item(
+			          item_list,
+			          2,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_type(
+			          item,
+			          &item_type,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "item_type",
+			 item_type,
+			 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Test that a second copy into the item list fails, both with
+			 * and without LIBFWSI_PARSE_FLAG_LAZY, and leaves the items intact
+			 */
+			result = libfwsi_item_list_copy_from_byte_stream(
+			          item_list,
+			          fwsi_test_item_list_data1,
+			          127,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libfwsi_item_list_get_number_of_items(
+			          item_list,
+			          &number_of_items,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_items",
+			 number_of_items,
+			 3 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_item(
+			          item_list,
+			          1,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_clear(
+			          item_list,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_number_of_items(
+			          item_list,
+			          &number_of_items,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_items",
+			 number_of_items,
+			 0 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_clear(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 127 );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          NULL,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the data size of an item list that only contains a terminator
+	 * is not accumulated when the item list is copied again
+	 */
+	result = libfwsi_item_list_clear(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 125 ] ),
+	          2,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 125 ] ),
+	          2,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_try_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_try_copy_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t parse_error_offset      = 0;
+	int number_of_items            = 0;
+	int parse_error                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_try_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &parse_error,
+	          &parse_error_offset );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_error",
+	 parse_error,
+	 LIBFWSI_PARSE_ERROR_NONE );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_clear(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a truncated shell item list
+	 */
+	result = libfwsi_item_list_try_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          100,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &parse_error,
+	          &parse_error_offset );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_error",
+	 parse_error,
+	 LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_error_offset",
+	 parse_error_offset,
+	 (size_t) 45 );
+
+	result = libfwsi_item_list_clear(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_try_copy_from_byte_stream(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &parse_error,
+	          &parse_error_offset );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_error",
+	 parse_error,
+	 LIBFWSI_PARSE_ERROR_INVALID_ARGUMENT );
+
+	result = libfwsi_item_list_try_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &parse_error,
+	          &parse_error_offset );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_error",
+	 parse_error,
+	 LIBFWSI_PARSE_ERROR_BYTE_STREAM_TOO_SMALL );
+
+	result = libfwsi_item_list_try_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_error_offset );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_copy_tail_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_tail_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int item_type                  = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_copy_tail_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 82 );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 1 );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          0,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_clear(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test more tail items than items in the list
+	 */
+	result = libfwsi_item_list_copy_tail_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          8,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_copy_tail_from_byte_stream(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_tail_from_byte_stream(
+	          item_list,
+	          NULL,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_tail_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_copy_from_byte_stream function with the LIBFWSI_PARSE_FLAG_BORROW_DATA parse flag
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_borrow_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_t *item                       = NULL;
+	libfwsi_item_list_t *item_list             = NULL;
+	const uint8_t *data                        = NULL;
+	size_t data_size                           = 0;
+	uint8_t is_unicode                         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without borrowing the data
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_item_get_data(
+	          item,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_clear(
+	          item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_set_parse_flags(
+	          item_list,
+	          LIBFWSI_PARSE_FLAG_BORROW_DATA,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_item_get_data(
+	          item,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( fwsi_test_item_list_data1[ 45 ] ) ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 80 );
+
+	result = libfwsi_file_entry_get_name_data(
+	          item,
+	          &data,
+	          &data_size,
+	          &is_unicode,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( fwsi_test_item_list_data1[ 59 ] ) ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 5 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "is_unicode",
+	 (int) is_unicode,
+	 0 );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwsi_extension_block_get_data(
+	          extension_block,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( fwsi_test_item_list_data1[ 65 ] ) ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 58 );
+
+	result = libfwsi_file_entry_extension_get_long_name_data(
+	          extension_block,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( fwsi_test_item_list_data1[ 111 ] ) ),
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 10 );
+
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_data(
+	          item,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_extension_block_get_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_validate(
+     void )
+{
+	uint8_t byte_stream[ 127 ];
+
+	size_t list_size    = 0;
+	int number_of_items = 0;
+	int result          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          127,
+	          &list_size,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "list_size",
+	 list_size,
+	 (size_t) 127 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	/* Test with a truncated shell item list
+	 */
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          100,
+	          &list_size,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an extension block size value that is out of bounds
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwsi_test_item_list_data1,
+	 127 );
+
+	byte_stream[ 65 ] = 0x40;
+
+	result = libfwsi_item_list_validate(
+	          byte_stream,
+	          127,
+	          &list_size,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_validate(
+	          NULL,
+	          127,
+	          &list_size,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &list_size,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          127,
+	          NULL,
+	          &number_of_items );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          127,
+	          &list_size,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_set_parse_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_set_parse_flags(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	uint32_t parse_flags           = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_set_parse_flags(
+	          item_list,
+	          LIBFWSI_PARSE_FLAG_LAZY,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_parse_flags(
+	          item_list,
+	          &parse_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "parse_flags",
+	 parse_flags,
+	 (uint32_t) LIBFWSI_PARSE_FLAG_LAZY );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_set_parse_flags(
+	          NULL,
+	          LIBFWSI_PARSE_FLAG_LAZY,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_set_parse_flags(
+	          item_list,
+	          0x80000000UL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_set_decode_types function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_set_decode_types(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_list_t *item_list             = NULL;
+	libfwsi_item_t *item                       = NULL;
+	uint64_t extension_block_signatures        = 0;
+	uint64_t file_reference                    = 0;
+	uint32_t file_attribute_flags              = 0;
+	uint32_t item_types                        = 0;
+	uint32_t signature                         = 0;
+	int item_type                              = 0;
+	int number_of_extension_blocks             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_decode_types(
+	          item_list,
+	          &item_types,
+	          &extension_block_signatures,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "item_types",
+	 item_types,
+	 (uint32_t) LIBFWSI_DECODE_ITEM_TYPES_ALL );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "extension_block_signatures",
+	 extension_block_signatures,
+	 (uint64_t) LIBFWSI_DECODE_EXTENSION_BLOCK_SIGNATURES_ALL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_set_decode_types(
+	          item_list,
+	          LIBFWSI_DECODE_ITEM_TYPE( LIBFWSI_ITEM_TYPE_FILE_ENTRY ),
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The type of an item that is not decoded is retained
+	 */
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          0,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_file_entry_get_file_attribute_flags(
+	          item,
+	          &file_attribute_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_number_of_extension_blocks(
+	          item,
+	          &number_of_extension_blocks,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_get_signature(
+	          extension_block,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 signature,
+	 (uint32_t) 0xbeef0004UL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values of an extension block that is not decoded are not available
+	 */
+	result = libfwsi_file_entry_extension_get_file_reference(
+	          extension_block,
+	          &file_reference,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_extension_block_free(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_set_decode_types(
+	          NULL,
+	          LIBFWSI_DECODE_ITEM_TYPES_ALL,
+	          LIBFWSI_DECODE_EXTENSION_BLOCK_SIGNATURES_ALL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_set_decode_types(
+	          item_list,
+	          LIBFWSI_DECODE_ITEM_TYPES_ALL,
+	          LIBFWSI_DECODE_EXTENSION_BLOCK_SIGNATURES_ALL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_decode_types(
+	          item_list,
+	          NULL,
+	          &extension_block_signatures,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the items of which the values are not decoded by libfwsi_item_list_copy_from_byte_stream
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_skipped_items(
+     void )
+{
+	uint8_t byte_stream[ 18 ] = {
+		0x10, 0x00, 0x00, 0x00, 0x41, 0x75, 0x67, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00 };
+
+	uint32_t parse_flags[ 4 ]      = {
+		0,
+		LIBFWSI_PARSE_FLAG_USE_ARENA,
+		LIBFWSI_PARSE_FLAG_BORROW_DATA,
+		LIBFWSI_PARSE_FLAG_LAZY };
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_item_t *item           = NULL;
+	const uint8_t *data            = NULL;
+	size_t data_size               = 0;
+	uint32_t signature             = 0;
+	uint8_t class_type             = 0;
+	int item_type                  = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+
+	for( parse_flags_index = 0;
+	     parse_flags_index < 4;
+	     parse_flags_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_parse_flags(
+		          item_list,
+		          parse_flags[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_decode_types(
+		          item_list,
+		          LIBFWSI_DECODE_ITEM_TYPE( LIBFWSI_ITEM_TYPE_FILE_ENTRY ),
+		          0,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test an item of a type determined by its class type
+		 */
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          127,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          1,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_type(
+		          item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_VOLUME );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_class_type(
+		          item,
+		          &class_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "class_type",
+		 (int) class_type,
+		 0x2f );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_data(
+		          item,
+		          &data,
+		          &data_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 (size_t) 25 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          &( fwsi_test_item_list_data1[ 20 ] ),
+		          25 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libfwsi_item_free(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_clear(
+		          item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test an item of a type determined by its signature
+		 */
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          byte_stream,
+		          18,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_item(
+		          item_list,
+		          0,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_type(
+		          item,
+		          &item_type,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "item_type",
+		 item_type,
+		 LIBFWSI_ITEM_TYPE_CDBURN );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_signature(
+		          item,
+		          &signature,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_UINT32(
+		 "signature",
+		 signature,
+		 (uint32_t) 0x4d677541UL );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_get_data(
+		          item,
+		          &data,
+		          &data_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 (size_t) 16 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          byte_stream,
+		          16 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libfwsi_item_free(
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests libfwsi_item_list_copy_from_byte_stream with an item list of which the last item is invalid
+ * and the reuse of the item list after the failure
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_invalid_last_item(
+     void )
+{
+	uint8_t *byte_streams[ 2 ] = {
+		fwsi_test_item_list_data2,
+		fwsi_test_item_list_data3 };
+
+	size_t byte_stream_sizes[ 2 ] = {
+		133,
+		131 };
+
+	uint32_t parse_flags[ 3 ]      = {
+		0,
+		LIBFWSI_PARSE_FLAG_USE_ARENA,
+		LIBFWSI_PARSE_FLAG_BORROW_DATA };
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_item_t *item           = NULL;
+	size_t data_size               = 0;
+	int byte_stream_index          = 0;
+	int item_index                 = 0;
+	int number_of_items            = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+
+	for( parse_flags_index = 0;
+	     parse_flags_index < 3;
+	     parse_flags_index++ )
+	{
+		/* The last item of the first byte stream cannot be decoded and the size
+		 * of the last item of the second byte stream exceeds the byte stream
+		 */
+		for( byte_stream_index = 0;
+		     byte_stream_index < 2;
+		     byte_stream_index++ )
+		{
+			/* Initialize test
+			 */
+			result = libfwsi_item_list_initialize(
+			          &item_list,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item_list",
+			 item_list );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_set_parse_flags(
+			          item_list,
+			          parse_flags[ parse_flags_index ],
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Test error cases
+			 */
+			result = libfwsi_item_list_copy_from_byte_stream(
+			          item_list,
+			          byte_streams[ byte_stream_index ],
+			          byte_stream_sizes[ byte_stream_index ],
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			/* Test that the items read before the last item are removed
+			 */
+			result = libfwsi_item_list_get_number_of_items(
+			          item_list,
+			          &number_of_items,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_items",
+			 number_of_items,
+			 0 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Test that the item list can be reused without clearing it
+			 */
+			result = libfwsi_item_list_copy_from_byte_stream(
+			          item_list,
+			          fwsi_test_item_list_data1,
+			          127,
+			          LIBFWSI_CODEPAGE_WINDOWS_1252,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_data_size(
+			          item_list,
+			          &data_size,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "data_size",
+			 data_size,
+			 (size_t) 127 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_list_get_number_of_items(
+			          item_list,
+			          &number_of_items,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_items",
+			 number_of_items,
+			 3 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( item_index = 0;
+			     item_index < number_of_items;
+			     item_index++ )
+			{
+				item = NULL;
+
+				result = libfwsi_item_list_get_item(
+				          item_list,
+				          item_index,
+				          &item,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FWSI_TEST_ASSERT_IS_NOT_NULL(
+				 "item",
+				 item );
+
+				FWSI_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			/* Clean up
+			 */
+			result = libfwsi_item_list_free(
+			          &item_list,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "item_list",
+			 item_list );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests libfwsi_item_list_copy_from_byte_stream with an item list that ends in a single byte
+ * instead of a terminator, which is rejected both when the items are read directly and lazily
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_trailing_byte(
+     void )
+{
+	uint32_t parse_flags[ 2 ]      = {
+		0,
+		LIBFWSI_PARSE_FLAG_LAZY };
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t parse_error_offset      = 0;
+	int number_of_items            = 0;
+	int parse_error                = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+
+	for( parse_flags_index = 0;
+	     parse_flags_index < 2;
+	     parse_flags_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_parse_flags(
+		          item_list,
+		          parse_flags[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          126,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_item_list_try_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          126,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &parse_error,
+		          &parse_error_offset );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "parse_error",
+		 parse_error,
+		 LIBFWSI_PARSE_ERROR_ITEM_SIZE_OUT_OF_BOUNDS );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "parse_error_offset",
+		 parse_error_offset,
+		 (size_t) 125 );
+
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 0 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests libfwsi_item_list_copy_from_byte_stream with items that contain 0, 1 and 3 extension blocks
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_extension_blocks(
+     void )
+{
+	int expected_number_of_extension_blocks[ 3 ] = {
+		0,
+		1,
+		3 };
+
+	uint32_t parse_flags[ 3 ]      = {
+		0,
+		LIBFWSI_PARSE_FLAG_USE_ARENA,
+		LIBFWSI_PARSE_FLAG_BORROW_DATA };
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_item_t *item           = NULL;
+	int item_index                 = 0;
+	int number_of_extension_blocks = 0;
+	int number_of_items            = 0;
+	int parse_flags_index          = 0;
+	int result                     = 0;
+
+	for( parse_flags_index = 0;
+	     parse_flags_index < 3;
+	     parse_flags_index++ )
+	{
+		/* Initialize test
+		 */
+		result = libfwsi_item_list_initialize(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_set_parse_flags(
+		          item_list,
+		          parse_flags[ parse_flags_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data4,
+		          236,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( item_index = 0;
+		     item_index < 3;
+		     item_index++ )
+		{
+			result = libfwsi_item_list_get_item(
+			          item_list,
+			          item_index,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "item",
+			 item );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwsi_item_get_number_of_extension_blocks(
+			          item,
+			          &number_of_extension_blocks,
+			          &error );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_extension_blocks",
+			 number_of_extension_blocks,
+			 expected_number_of_extension_blocks[ item_index ] );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+			/* Test that no reserved extension block entries remain unused
+			 */
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "number_of_allocated_extension_blocks",
+			 ( (libfwsi_internal_item_t *) item )->number_of_allocated_extension_blocks,
+			 expected_number_of_extension_blocks[ item_index ] );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+		}
+		/* Clean up
+		 */
+		result = libfwsi_item_list_free(
+		          &item_list,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "item_list",
+		 item_list );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_t *lazy_item      = NULL;
+	size_t data_size               = 0;
+	int item_type                  = 0;
+	int number_of_extension_blocks = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_set_parse_flags(
+	          item_list,
+	          LIBFWSI_PARSE_FLAG_LAZY | LIBFWSI_PARSE_FLAG_USE_ARENA,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 127 );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	result = libfwsi_item_get_number_of_extension_blocks(
+	          item,
+	          &number_of_extension_blocks,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	/* Test if the item is only read once
+	 */
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &lazy_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "lazy_item == item",
+	 (int) ( lazy_item == item ),
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &lazy_item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item(
+	          NULL,
+	          0,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          -1,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The visit state used by the libfwsi_item_list_visit_byte_stream test callbacks
+ */
+typedef struct fwsi_test_item_list_visit_state fwsi_test_item_list_visit_state_t;
+
+struct fwsi_test_item_list_visit_state
+{
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The number of extension blocks
+	 */
+	int number_of_extension_blocks;
+
+	/* The type of the last item
+	 */
+	int last_item_type;
+
+	/* The offset of the last item
+	 */
+	size_t last_item_offset;
+
+	/* The offset of the last extension block
+	 */
+	size_t last_extension_block_offset;
+
+	/* The signature of the last extension block
+	 */
+	uint32_t last_extension_block_signature;
+
+	/* The item index at which the item callback stops
+	 */
+	int stop_item_index;
+};
+
+/* Tests the libfwsi_item_list_get_utf8_path_size and libfwsi_item_list_get_utf8_path functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf8_path(
+     void )
+{
+	uint8_t expected_utf8_path[ 20 ] = {
+		'M', 'y', ' ', 'C', 'o', 'm', 'p', 'u', 't', 'e', 'r', '\\', 'C', ':', '\\', 'D', 'i', 'r', '0', 0 };
+
+	uint8_t utf8_path[ 32 ];
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t utf8_path_size          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          &utf8_path_size,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 20 );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          utf8_path,
+	          32,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path,
+	          20 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf8_path_size(
+	          NULL,
+	          &utf8_path_size,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          NULL,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path_size(
+	          item_list,
+	          &utf8_path_size,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          NULL,
+	          utf8_path,
+	          32,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          NULL,
+	          32,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          utf8_path,
+	          (size_t) SSIZE_MAX + 1,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          utf8_path,
+	          8,
+	          (uint8_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf8_path(
+	          item_list,
+	          utf8_path,
+	          32,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_utf16_path_size and libfwsi_item_list_get_utf16_path functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_utf16_path(
+     void )
+{
+	uint16_t expected_utf16_path[ 20 ] = {
+		'M', 'y', ' ', 'C', 'o', 'm', 'p', 'u', 't', 'e', 'r', '\\', 'C', ':', '\\', 'D', 'i', 'r', '0', 0 };
+
+	uint16_t utf16_path[ 32 ];
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t utf16_path_size         = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          &utf16_path_size,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_path_size",
+	 utf16_path_size,
+	 (size_t) 20 );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          utf16_path,
+	          32,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_path,
+	          expected_utf16_path,
+	          sizeof( uint16_t ) * 20 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_utf16_path_size(
+	          NULL,
+	          &utf16_path_size,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          NULL,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path_size(
+	          item_list,
+	          &utf16_path_size,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          NULL,
+	          utf16_path,
+	          32,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          NULL,
+	          32,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          utf16_path,
+	          (size_t) SSIZE_MAX + 1,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          utf16_path,
+	          8,
+	          (uint16_t) '\\',
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_utf16_path(
+	          item_list,
+	          utf16_path,
+	          32,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Item callback used to test the libfwsi_item_list_visit_byte_stream function
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fwsi_test_item_list_visit_item_callback(
+     libfwsi_item_t *item,
+     int item_index,
+     size_t item_offset,
+     const uint8_t *item_data,
+     size_t item_data_size,
+     void *callback_data )
+{
+	fwsi_test_item_list_visit_state_t *visit_state = NULL;
+	size_t data_size                               = 0;
+
+	if( ( item_data == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	visit_state = (fwsi_test_item_list_visit_state_t *) callback_data;
+
+	if( item_index == visit_state->stop_item_index )
+	{
+		return( 0 );
+	}
+	if( libfwsi_item_get_type(
+	     item,
+	     &( visit_state->last_item_type ),
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfwsi_item_get_data_size(
+	     item,
+	     &data_size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( data_size != item_data_size )
+	{
+		return( -1 );
+	}
+	visit_state->last_item_offset = item_offset;
+
+	visit_state->number_of_items += 1;
+
+	return( 1 );
+}
+
+/* Extension block callback used to test the libfwsi_item_list_visit_byte_stream function
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int fwsi_test_item_list_visit_extension_block_callback(
+     libfwsi_extension_block_t *extension_block,
+     int item_index FWSI_TEST_ATTRIBUTE_UNUSED,
+     int extension_block_index FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t extension_block_offset,
+     const uint8_t *extension_block_data,
+     size_t extension_block_data_size,
+     void *callback_data )
+{
+	fwsi_test_item_list_visit_state_t *visit_state = NULL;
+
+	FWSI_TEST_UNREFERENCED_PARAMETER( item_index )
+	FWSI_TEST_UNREFERENCED_PARAMETER( extension_block_index )
+
+	if( ( extension_block_data == NULL )
+	 || ( extension_block_data_size < 2 )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	visit_state = (fwsi_test_item_list_visit_state_t *) callback_data;
+
+	if( (size_t) extension_block_data[ 0 ] != extension_block_data_size )
+	{
+		return( -1 );
+	}
+	if( libfwsi_extension_block_get_signature(
+	     extension_block,
+	     &( visit_state->last_extension_block_signature ),
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	visit_state->last_extension_block_offset = extension_block_offset;
+
+	visit_state->number_of_extension_blocks += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_item_list_visit_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_visit_byte_stream(
+     void )
+{
+	fwsi_test_item_list_visit_state_t visit_state;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &visit_state,
+	 0,
+	 sizeof( fwsi_test_item_list_visit_state_t ) );
+
+	visit_state.stop_item_index = -1;
+
+	result = libfwsi_item_list_visit_byte_stream(
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &fwsi_test_item_list_visit_item_callback,
+	          &fwsi_test_item_list_visit_extension_block_callback,
+	          &visit_state,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "visit_state.number_of_items",
+	 visit_state.number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "visit_state.last_item_type",
+	 visit_state.last_item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "visit_state.last_item_offset",
+	 visit_state.last_item_offset,
+	 (size_t) 45 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "visit_state.number_of_extension_blocks",
+	 visit_state.number_of_extension_blocks,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "visit_state.last_extension_block_offset",
+	 visit_state.last_extension_block_offset,
+	 (size_t) 65 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "visit_state.last_extension_block_signature",
+	 visit_state.last_extension_block_signature,
+	 (uint32_t) 0xbeef0004UL );
+
+	/* Test stopping the visit from a callback
+	 */
+	memory_set(
+	 &visit_state,
+	 0,
+	 sizeof( fwsi_test_item_list_visit_state_t ) );
+
+	visit_state.stop_item_index = 1;
+
+	result = libfwsi_item_list_visit_byte_stream(
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &fwsi_test_item_list_visit_item_callback,
+	          NULL,
+	          &visit_state,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "visit_state.number_of_items",
+	 visit_state.number_of_items,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_visit_byte_stream(
+	          NULL,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_visit_byte_stream(
+	          fwsi_test_item_list_data1,
+	          100,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported codepage, which is rejected even if there are no items to visit
+	 */
+	memory_set(
+	 &visit_state,
+	 0,
+	 sizeof( fwsi_test_item_list_visit_state_t ) );
+
+	visit_state.stop_item_index = -1;
+
+	result = libfwsi_item_list_visit_byte_stream(
+	          &( fwsi_test_item_list_data1[ 125 ] ),
+	          2,
+	          -1,
+	          &fwsi_test_item_list_visit_item_callback,
+	          NULL,
+	          &visit_state,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "visit_state.number_of_items",
+	 visit_state.number_of_items,
+	 0 );
+
+	/* Test with an item callback that fails
+	 */
+	result = libfwsi_item_list_visit_byte_stream(
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &fwsi_test_item_list_visit_item_callback,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_visit_byte_stream_with_item_list function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_visit_byte_stream_with_item_list(
+     void )
+{
+	fwsi_test_item_list_visit_state_t visit_state;
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int number_of_items            = 0;
+	int result                     = 0;
+	int visit_iterator             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the memory of the item list is reused by the second visit
+	 */
+	for( visit_iterator = 0;
+	     visit_iterator < 2;
+	     visit_iterator++ )
+	{
+		memory_set(
+		 &visit_state,
+		 0,
+		 sizeof( fwsi_test_item_list_visit_state_t ) );
+
+		visit_state.stop_item_index = -1;
+
+		result = libfwsi_item_list_visit_byte_stream_with_item_list(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          127,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &fwsi_test_item_list_visit_item_callback,
+		          &fwsi_test_item_list_visit_extension_block_callback,
+		          &visit_state,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "visit_state.number_of_items",
+		 visit_state.number_of_items,
+		 3 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "visit_state.last_item_type",
+		 visit_state.last_item_type,
+		 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "visit_state.number_of_extension_blocks",
+		 visit_state.number_of_extension_blocks,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_UINT32(
+		 "visit_state.last_extension_block_signature",
+		 visit_state.last_extension_block_signature,
+		 (uint32_t) 0xbeef0004UL );
+	}
+	/* The items of the item list are not changed by a visit
+	 */
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_visit_byte_stream_with_item_list(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          127,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_visit_byte_stream_with_item_list(
+	          item_list,
+	          &( fwsi_test_item_list_data1[ 125 ] ),
+	          2,
+	          -1,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_initialize",
+	 fwsi_test_item_list_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_free",
+	 fwsi_test_item_list_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_clear",
+	 fwsi_test_item_list_clear );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream",
+	 fwsi_test_item_list_copy_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_borrow_data",
+	 fwsi_test_item_list_copy_from_byte_stream_borrow_data );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_try_copy_from_byte_stream",
+	 fwsi_test_item_list_try_copy_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_tail_from_byte_stream",
+	 fwsi_test_item_list_copy_tail_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_validate",
+	 fwsi_test_item_list_validate );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_set_parse_flags",
+	 fwsi_test_item_list_set_parse_flags );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_set_decode_types",
+	 fwsi_test_item_list_set_decode_types );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_skipped_items",
+	 fwsi_test_item_list_copy_from_byte_stream_skipped_items );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_invalid_last_item",
+	 fwsi_test_item_list_copy_from_byte_stream_invalid_last_item );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_trailing_byte",
+	 fwsi_test_item_list_copy_from_byte_stream_trailing_byte );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_extension_blocks",
+	 fwsi_test_item_list_copy_from_byte_stream_extension_blocks );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item",
+	 fwsi_test_item_list_get_item );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_utf8_path",
+	 fwsi_test_item_list_get_utf8_path );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_utf16_path",
+	 fwsi_test_item_list_get_utf16_path );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_visit_byte_stream",
+	 fwsi_test_item_list_visit_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_visit_byte_stream_with_item_list",
+	 fwsi_test_item_list_visit_byte_stream_with_item_list );
 
 	return( EXIT_SUCCESS );
 
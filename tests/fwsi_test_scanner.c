@@ -0,0 +1,1574 @@
+/*
+ * Library scanner type testing program
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_item.h"
+#include "../libfwsi/libfwsi_scanner.h"
+
+uint8_t fwsi_test_scanner_data1[ 127 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfwsi_scanner_t *scanner = NULL;
+	int result                 = 0;
+
+	/* Test libfwsi_scanner_initialize
+	 */
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "scanner",
+         scanner );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "scanner",
+         scanner );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scanner = (libfwsi_scanner_t *) 0x12345678UL;
+
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	scanner = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	/* Test libfwsi_scanner_initialize with malloc failing
+	 */
+	fwsi_test_malloc_attempts_before_fail = 0;
+
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	if( fwsi_test_malloc_attempts_before_fail != -1 )
+	{
+		fwsi_test_malloc_attempts_before_fail = -1;
+
+		if( scanner != NULL )
+		{
+			libfwsi_scanner_free(
+			 &scanner,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfwsi_scanner_initialize with memset failing
+	 */
+	fwsi_test_memset_attempts_before_fail = 0;
+
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	if( fwsi_test_memset_attempts_before_fail != -1 )
+	{
+		fwsi_test_memset_attempts_before_fail = -1;
+
+		if( scanner != NULL )
+		{
+			libfwsi_scanner_free(
+			 &scanner,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_scanner_set_minimum_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_set_minimum_number_of_items(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libfwsi_scanner_t *scanner  = NULL;
+	int minimum_number_of_items = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_scanner_set_minimum_number_of_items(
+	          scanner,
+	          3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_minimum_number_of_items(
+	          scanner,
+	          &minimum_number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "minimum_number_of_items",
+	 minimum_number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_set_minimum_number_of_items(
+	          NULL,
+	          3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_set_minimum_number_of_items(
+	          scanner,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_scanner_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_set_number_of_threads(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfwsi_scanner_t *scanner = NULL;
+	int number_of_threads      = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_scanner_set_number_of_threads(
+	          scanner,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_threads(
+	          scanner,
+	          &number_of_threads,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 4 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_set_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_set_number_of_threads(
+	          scanner,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_scanner_check_item function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_check_item(
+     void )
+{
+	uint8_t item_data[ 80 ];
+
+	int expected_result = 0;
+	int result          = 0;
+
+	/* Initialize test, the file entry shell item of the data
+	 * contains an extension block at offset 20
+	 */
+	if( memory_copy(
+	     item_data,
+	     &( fwsi_test_scanner_data1[ 45 ] ),
+	     80 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libfwsi_scanner_check_item(
+	          item_data,
+	          80 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a file entry shell item of which the extension block size exceeds the item,
+	 * which is rejected as by libfwsi_item_validate
+	 */
+	item_data[ 20 ] = 0x60;
+
+	expected_result = libfwsi_item_validate(
+	                   item_data,
+	                   80 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 0 );
+
+	result = libfwsi_scanner_check_item(
+	          item_data,
+	          80 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	item_data[ 20 ] = 0x3a;
+
+	/* Test a file entry shell item of which the last 2 bytes do not reference an extension block,
+	 * which is accepted as by libfwsi_item_validate
+	 */
+	item_data[ 27 ] = 0x00;
+
+	expected_result = libfwsi_item_validate(
+	                   item_data,
+	                   80 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "expected_result",
+	 expected_result,
+	 1 );
+
+	result = libfwsi_scanner_check_item(
+	          item_data,
+	          80 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_check_item(
+	          item_data,
+	          2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* Tests the libfwsi_scanner_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error   = NULL;
+	libfwsi_scanner_t *scanner = NULL;
+	size_t offset              = 0;
+	size_t size                = 0;
+	int number_of_items        = 0;
+	int number_of_results      = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 512 );
+
+	memory_set(
+	 &( buffer[ 64 ] ),
+	 0xff,
+	 16 );
+
+	memory_copy(
+	 &( buffer[ 101 ] ),
+	 fwsi_test_scanner_data1,
+	 127 );
+
+	memory_copy(
+	 &( buffer[ 300 ] ),
+	 fwsi_test_scanner_data1,
+	 127 );
+
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_scanner_scan_buffer(
+	          scanner,
+	          buffer,
+	          512,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_result_by_index(
+	          scanner,
+	          1,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 300 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 127 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scanning with a minimum number of items that exceeds the number of items in the lists
+	 */
+	result = libfwsi_scanner_set_minimum_number_of_items(
+	          scanner,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_scan_buffer(
+	          scanner,
+	          buffer,
+	          512,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_scan_buffer(
+	          NULL,
+	          buffer,
+	          512,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer(
+	          scanner,
+	          NULL,
+	          512,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_get_result_by_index(
+	          scanner,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_scanner_scan_buffer_window function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_scan_buffer_window(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error   = NULL;
+	libfwsi_scanner_t *scanner = NULL;
+	size_t next_offset         = 0;
+	size_t offset              = 0;
+	size_t size                = 0;
+	int number_of_items        = 0;
+	int number_of_results      = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 512 );
+
+	memory_copy(
+	 &( buffer[ 101 ] ),
+	 fwsi_test_scanner_data1,
+	 127 );
+
+	memory_copy(
+	 &( buffer[ 300 ] ),
+	 fwsi_test_scanner_data1,
+	 127 );
+
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the buffer is scanned in 2 parts of which the first starts
+	 * at data stream offset 1000 and the second at data stream offset 1200
+	 * The candidate at buffer offset 101 crosses the end of the first window and is read
+	 * from the overlap, the scan of the second part continues after its end
+	 */
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          512,
+	          1000,
+	          0,
+	          200,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	result = libfwsi_scanner_get_result_by_index(
+	          scanner,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 1101 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 127 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "next_offset",
+	 next_offset,
+	 (size_t) 228 );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          &( buffer[ 200 ] ),
+	          312,
+	          1200,
+	          next_offset - 200,
+	          312,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	result = libfwsi_scanner_get_result_by_index(
+	          scanner,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 1300 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 127 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "next_offset",
+	 next_offset,
+	 (size_t) 312 );
+
+	/* Test a window without overlap, the candidate that does not end within the buffer is not reported
+	 */
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          200,
+	          0,
+	          0,
+	          200,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_scanner_scan_buffer_window(
+	          NULL,
+	          buffer,
+	          512,
+	          0,
+	          0,
+	          512,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          NULL,
+	          512,
+	          0,
+	          0,
+	          512,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          512,
+	          0,
+	          0,
+	          513,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          512,
+	          0,
+	          256,
+	          200,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          512,
+	          (size_t) SSIZE_MAX,
+	          0,
+	          512,
+	          &next_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_scanner_scan_buffer_window(
+	          scanner,
+	          buffer,
+	          512,
+	          0,
+	          0,
+	          512,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_scanner_scan_buffer function using multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_scanner_scan_buffer_multi_threaded(
+     void )
+{
+	size_t expected_offsets[ 4 ] = {
+		1000, ( 16 * 1024 * 1024 ) - 60, ( 32 * 1024 * 1024 ) - 1, 34000000 };
+
+	libcerror_error_t *error     = NULL;
+	libfwsi_scanner_t *scanner   = NULL;
+	uint8_t *buffer              = NULL;
+	size_t buffer_size           = 35 * 1024 * 1024;
+	size_t offset                = 0;
+	size_t size                  = 0;
+	int number_of_items          = 0;
+	int number_of_results        = 0;
+	int result                   = 0;
+	int result_index             = 0;
+
+	/* Initialize test
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	memory_set(
+	 buffer,
+	 0,
+	 buffer_size );
+
+	/* The shell item lists are placed at the start of the buffer, across chunk
+	 * boundaries and near the end of the buffer
+	 */
+	for( result_index = 0;
+	     result_index < 4;
+	     result_index++ )
+	{
+		memory_copy(
+		 &( buffer[ expected_offsets[ result_index ] ] ),
+		 fwsi_test_scanner_data1,
+		 127 );
+	}
+	result = libfwsi_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_set_number_of_threads(
+	          scanner,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_scanner_scan_buffer(
+	          scanner,
+	          buffer,
+	          buffer_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_scanner_get_number_of_results(
+	          scanner,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 4 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( result_index = 0;
+	     result_index < 4;
+	     result_index++ )
+	{
+		result = libfwsi_scanner_get_result_by_index(
+		          scanner,
+		          result_index,
+		          &offset,
+		          &size,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "offset",
+		 offset,
+		 expected_offsets[ result_index ] );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "size",
+		 size,
+		 (size_t) 127 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfwsi_scanner_free(
+	          &scanner,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libfwsi_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_initialize",
+	 fwsi_test_scanner_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_free",
+	 fwsi_test_scanner_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_set_minimum_number_of_items",
+	 fwsi_test_scanner_set_minimum_number_of_items );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_set_number_of_threads",
+	 fwsi_test_scanner_set_number_of_threads );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_check_item",
+	 fwsi_test_scanner_check_item );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_scan_buffer",
+	 fwsi_test_scanner_scan_buffer );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_scan_buffer (multi-threaded)",
+	 fwsi_test_scanner_scan_buffer_multi_threaded );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_scanner_scan_buffer_window",
+	 fwsi_test_scanner_scan_buffer_window );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,651 @@
+/*
+ * Library stream parser type testing program
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+uint8_t fwsi_test_stream_parser_data1[ 127 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x31,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x44, 0x69, 0x72, 0x30, 0x00,
+	0x00, 0x3a, 0x00, 0x09, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22,
+	0x22, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x69, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_stream_parser_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_stream_parser_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_stream_parser_t *stream_parser = NULL;
+	int result                             = 0;
+
+	/* Test libfwsi_stream_parser_initialize
+	 */
+	result = libfwsi_stream_parser_initialize(
+	          &stream_parser,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "stream_parser",
+         stream_parser );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libfwsi_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "stream_parser",
+         stream_parser );
+
+        FWSI_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_stream_parser_initialize(
+	          NULL,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_parser = (libfwsi_stream_parser_t *) 0x12345678UL;
+
+	result = libfwsi_stream_parser_initialize(
+	          &stream_parser,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_parser = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	/* Test libfwsi_stream_parser_initialize with malloc failing
+	 */
+	fwsi_test_malloc_attempts_before_fail = 0;
+
+	result = libfwsi_stream_parser_initialize(
+	          &stream_parser,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	if( fwsi_test_malloc_attempts_before_fail != -1 )
+	{
+		fwsi_test_malloc_attempts_before_fail = -1;
+
+		if( stream_parser != NULL )
+		{
+			libfwsi_stream_parser_free(
+			 &stream_parser,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "stream_parser",
+		 stream_parser );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfwsi_stream_parser_initialize with memset failing
+	 */
+	fwsi_test_memset_attempts_before_fail = 0;
+
+	result = libfwsi_stream_parser_initialize(
+	          &stream_parser,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	if( fwsi_test_memset_attempts_before_fail != -1 )
+	{
+		fwsi_test_memset_attempts_before_fail = -1;
+
+		if( stream_parser != NULL )
+		{
+			libfwsi_stream_parser_free(
+			 &stream_parser,
+			 NULL );
+		}
+	}
+	else
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "stream_parser",
+		 stream_parser );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libfwsi_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_stream_parser_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_stream_parser_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_stream_parser_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        FWSI_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_stream_parser_push_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_stream_parser_push_data(
+     void )
+{
+	size_t chunk_sizes[ 4 ] = {
+		1,
+		7,
+		64,
+		127 };
+
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_t *item                   = NULL;
+	libfwsi_stream_parser_t *stream_parser = NULL;
+	size_t chunk_size                      = 0;
+	size_t consumed_data_size              = 0;
+	size_t data_offset                     = 0;
+	size_t offset                          = 0;
+	int chunk_size_index                   = 0;
+	int number_of_items                    = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_stream_parser_initialize(
+	          &stream_parser,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( chunk_size_index = 0;
+	     chunk_size_index < 4;
+	     chunk_size_index++ )
+	{
+		result = libfwsi_stream_parser_reset(
+		          stream_parser,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		number_of_items = 0;
+		data_offset     = 0;
+
+		while( data_offset < 127 )
+		{
+			chunk_size = chunk_sizes[ chunk_size_index ];
+
+			if( chunk_size > ( 127 - data_offset ) )
+			{
+				chunk_size = 127 - data_offset;
+			}
+			result = libfwsi_stream_parser_push_data(
+			          stream_parser,
+			          &( fwsi_test_stream_parser_data1[ data_offset ] ),
+			          chunk_size,
+			          &consumed_data_size,
+			          &item,
+			          &error );
+
+			FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			data_offset += consumed_data_size;
+
+			if( result == 1 )
+			{
+				number_of_items++;
+
+				result = libfwsi_item_free(
+				          &item,
+				          &error );
+
+				FWSI_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+		}
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		result = libfwsi_stream_parser_is_finished(
+		          stream_parser,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfwsi_stream_parser_get_number_of_items(
+		          stream_parser,
+		          &number_of_items,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "number_of_items",
+		 number_of_items,
+		 3 );
+
+		result = libfwsi_stream_parser_get_offset(
+		          stream_parser,
+		          &offset,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "offset",
+		 offset,
+		 (size_t) 127 );
+	}
+	/* Test that no data is consumed after the terminator
+	 */
+	result = libfwsi_stream_parser_push_data(
+	          stream_parser,
+	          fwsi_test_stream_parser_data1,
+	          127,
+	          &consumed_data_size,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "consumed_data_size",
+	 consumed_data_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream that ends within an item
+	 */
+	result = libfwsi_stream_parser_reset(
+	          stream_parser,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data_offset = 0;
+
+	do
+	{
+		result = libfwsi_stream_parser_push_data(
+		          stream_parser,
+		          &( fwsi_test_stream_parser_data1[ data_offset ] ),
+		          100 - data_offset,
+		          &consumed_data_size,
+		          &item,
+		          &error );
+
+		FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		data_offset += consumed_data_size;
+
+		if( item != NULL )
+		{
+			libfwsi_item_free(
+			 &item,
+			 NULL );
+		}
+	}
+	while( result == 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 100 );
+
+	result = libfwsi_stream_parser_get_number_of_items(
+	          stream_parser,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 2 );
+
+	result = libfwsi_stream_parser_is_finished(
+	          stream_parser,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_stream_parser_push_data(
+	          NULL,
+	          fwsi_test_stream_parser_data1,
+	          127,
+	          &consumed_data_size,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_stream_parser_push_data(
+	          stream_parser,
+	          NULL,
+	          127,
+	          &consumed_data_size,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_stream_parser_push_data(
+	          stream_parser,
+	          fwsi_test_stream_parser_data1,
+	          127,
+	          NULL,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_stream_parser_push_data(
+	          stream_parser,
+	          fwsi_test_stream_parser_data1,
+	          127,
+	          &consumed_data_size,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	if( stream_parser != NULL )
+	{
+		libfwsi_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_stream_parser_initialize",
+	 fwsi_test_stream_parser_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_stream_parser_free",
+	 fwsi_test_stream_parser_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_stream_parser_push_data",
+	 fwsi_test_stream_parser_push_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1770 @@
+/*
+ * Library string functions testing program
+ *
+ * Copyright (C) 2010-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_libuna.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_arena.h"
+#include "../libfwsi/libfwsi_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+uint8_t fwsi_test_string_byte_stream1[ 10 ] = {
+	'D', 'i', 'r', 'e', 'c', 't', 'o', 'r', 'y', 0 };
+
+uint8_t fwsi_test_string_utf16_stream1[ 12 ] = {
+	'L', 0, 'o', 0, 'c', 0, 'a', 0, 'l', 0, 0, 0 };
+
+/* 7 ASCII characters and the end of string character, which fill 8 UTF-16 units
+ */
+uint8_t fwsi_test_string_utf16_stream2[ 16 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x00, 0x00 };
+
+/* 8 ASCII characters, which cross the 8 UTF-16 unit boundary
+ */
+uint8_t fwsi_test_string_utf16_stream3[ 18 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x00, 0x00 };
+
+/* 15 ASCII characters
+ */
+uint8_t fwsi_test_string_utf16_stream4[ 32 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x00, 0x00 };
+
+/* 16 ASCII characters, which cross the 16 UTF-16 unit boundary
+ */
+uint8_t fwsi_test_string_utf16_stream5[ 34 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00,
+	0x00, 0x00 };
+
+/* 17 ASCII characters
+ */
+uint8_t fwsi_test_string_utf16_stream6[ 36 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00,
+	0x51, 0x00, 0x00, 0x00 };
+
+/* A non-ASCII character within the second block of 8 UTF-16 units
+ */
+uint8_t fwsi_test_string_utf16_stream7[ 36 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0x4a, 0x00, 0xe9, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00,
+	0x46, 0x00, 0x00, 0x00 };
+
+/* Characters that require 2 bytes in UTF-8
+ */
+uint8_t fwsi_test_string_utf16_stream8[ 10 ] = {
+	0x41, 0x00, 0xe9, 0x00, 0xff, 0x07, 0x80, 0x00, 0x00, 0x00 };
+
+/* Characters that require 3 bytes in UTF-8
+ */
+uint8_t fwsi_test_string_utf16_stream9[ 10 ] = {
+	0x00, 0x08, 0xac, 0x20, 0xfd, 0xff, 0x41, 0x00, 0x00, 0x00 };
+
+/* Surrogate pairs that require 4 bytes in UTF-8
+ */
+uint8_t fwsi_test_string_utf16_stream10[ 12 ] = {
+	0x3d, 0xd8, 0x00, 0xde, 0x41, 0x00, 0xff, 0xdb, 0xff, 0xdf, 0x00, 0x00 };
+
+/* Characters without an end of string character
+ */
+uint8_t fwsi_test_string_utf16_stream11[ 20 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00,
+	0x49, 0x00, 0xe9, 0x00 };
+
+/* Characters followed by data after the end of string character
+ */
+uint8_t fwsi_test_string_utf16_stream12[ 18 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00,
+	0x00, 0x00 };
+
+/* A lone high surrogate at the end of the stream
+ */
+uint8_t fwsi_test_string_utf16_stream13[ 4 ] = {
+	0x41, 0x00, 0x3d, 0xd8 };
+
+/* A lone high surrogate followed by an ASCII character
+ */
+uint8_t fwsi_test_string_utf16_stream14[ 8 ] = {
+	0x41, 0x00, 0x3d, 0xd8, 0x42, 0x00, 0x00, 0x00 };
+
+/* A lone low surrogate
+ */
+uint8_t fwsi_test_string_utf16_stream15[ 8 ] = {
+	0x41, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x00 };
+
+/* A leading byte order mark
+ */
+uint8_t fwsi_test_string_utf16_stream16[ 8 ] = {
+	0xff, 0xfe, 0x41, 0x00, 0x42, 0x00, 0x00, 0x00 };
+
+/* An odd size
+ */
+uint8_t fwsi_test_string_utf16_stream17[ 7 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43 };
+
+/* Tests the libfwsi_string_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_cache_free(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwsi_string_cache_t *string_cache = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_cache_free(
+	          &string_cache,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "string_cache",
+	 string_cache );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_cache_free(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_cache_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_cache_get_utf8_string(
+     void )
+{
+	uint8_t byte_stream[ 301 ];
+
+	const uint8_t *first_utf8_string     = NULL;
+	const uint8_t *utf8_string           = NULL;
+	libcerror_error_t *error             = NULL;
+	libfwsi_arena_t *arena               = NULL;
+	libfwsi_string_cache_t *string_cache = NULL;
+	size_t utf8_string_size              = 0;
+	int result                           = 0;
+	int test_iteration                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     byte_stream,
+	     'A',
+	     300 ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream[ 300 ] = 0;
+
+	result = libfwsi_arena_initialize(
+	          &arena,
+	          4096,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the first iteration allocates the string cache
+	 * with memory_allocate and the second iteration from the arena
+	 */
+	for( test_iteration = 0;
+	     test_iteration < 2;
+	     test_iteration++ )
+	{
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          0,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "string_cache",
+		 string_cache );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_string",
+		 utf8_string );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 10 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          "Directory",
+		          10 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test that a second call returns the string stored in the string cache
+		 */
+		first_utf8_string = utf8_string;
+		utf8_string       = NULL;
+
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          0,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "utf8_string == first_utf8_string",
+		 (int) ( utf8_string == first_utf8_string ),
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 10 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test a UTF-16 stream string
+		 */
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          1,
+		          fwsi_test_string_utf16_stream1,
+		          12,
+		          LIBFWSI_STRING_TYPE_UTF16_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 6 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          "Local",
+		          6 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test a string that does not fit in the conversion buffer
+		 */
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          2,
+		          byte_stream,
+		          301,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 (size_t) 301 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          byte_stream,
+		          301 );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test error cases
+		 */
+		result = libfwsi_string_cache_get_utf8_string(
+		          NULL,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          0,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          -1,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          LIBFWSI_STRING_CACHE_NUMBER_OF_STRINGS,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          0,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          NULL,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_string_cache_get_utf8_string(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          0,
+		          fwsi_test_string_byte_stream1,
+		          10,
+		          LIBFWSI_STRING_TYPE_BYTE_STREAM,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string,
+		          NULL,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up, the strings of a string cache allocated from the arena
+		 * are released with the arena
+		 */
+		result = libfwsi_string_cache_free(
+		          &string_cache,
+		          ( test_iteration == 0 ) ? NULL : arena,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "string_cache",
+		 string_cache );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfwsi_arena_free(
+	          &arena,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( string_cache != NULL )
+	 && ( test_iteration == 0 ) )
+	{
+		libfwsi_string_cache_free(
+		 &string_cache,
+		 NULL,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libfwsi_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_get_byte_stream_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_get_byte_stream_string_size(
+     void )
+{
+	size_t byte_stream_offsets[ 2 ] = {
+		0,
+		3 };
+
+	size_t terminator_offsets[ 5 ] = {
+		0,
+		5,
+		8,
+		15,
+		16 };
+
+	uint8_t byte_stream[ 40 ];
+
+	size_t byte_stream_offset = 0;
+	size_t string_size        = 0;
+	int offset_index          = 0;
+	int test_index            = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     byte_stream,
+	     'A',
+	     40 ) == NULL )
+	{
+		goto on_error;
+	}
+	for( offset_index = 0;
+	     offset_index < 2;
+	     offset_index++ )
+	{
+		byte_stream_offset = byte_stream_offsets[ offset_index ];
+
+		/* Test a terminator at the first byte, within and at the boundaries of the blocks
+		 * that are scanned at once
+		 */
+		for( test_index = 0;
+		     test_index < 5;
+		     test_index++ )
+		{
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] ] = 0;
+
+			string_size = libfwsi_string_get_byte_stream_string_size(
+			               byte_stream,
+			               40,
+			               byte_stream_offset );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "string_size",
+			 string_size,
+			 terminator_offsets[ test_index ] + 1 );
+
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] ] = 'A';
+		}
+		/* Test a string without a terminator that ends at the end of the byte stream
+		 */
+		string_size = libfwsi_string_get_byte_stream_string_size(
+		               byte_stream,
+		               40,
+		               byte_stream_offset );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_size",
+		 string_size,
+		 40 - byte_stream_offset );
+	}
+	/* Test error cases
+	 */
+	string_size = libfwsi_string_get_byte_stream_string_size(
+	               byte_stream,
+	               40,
+	               40 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	string_size = libfwsi_string_get_byte_stream_string_size(
+	               NULL,
+	               40,
+	               0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_get_utf16_stream_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_get_utf16_stream_string_size(
+     void )
+{
+	size_t byte_stream_offsets[ 2 ] = {
+		0,
+		3 };
+
+	size_t terminator_offsets[ 4 ] = {
+		0,
+		6,
+		14,
+		16 };
+
+	size_t unaligned_offsets[ 2 ] = {
+		5,
+		15 };
+
+	uint8_t byte_stream[ 40 ];
+
+	size_t byte_stream_offset = 0;
+	size_t string_size        = 0;
+	int offset_index          = 0;
+	int test_index            = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     byte_stream,
+	     'A',
+	     40 ) == NULL )
+	{
+		goto on_error;
+	}
+	for( offset_index = 0;
+	     offset_index < 2;
+	     offset_index++ )
+	{
+		byte_stream_offset = byte_stream_offsets[ offset_index ];
+
+		/* Test a terminator at the first character, within and at the boundaries of the blocks
+		 * that are scanned at once
+		 */
+		for( test_index = 0;
+		     test_index < 4;
+		     test_index++ )
+		{
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] ]     = 0;
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] + 1 ] = 0;
+
+			string_size = libfwsi_string_get_utf16_stream_string_size(
+			               byte_stream,
+			               40,
+			               byte_stream_offset );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "string_size",
+			 string_size,
+			 terminator_offsets[ test_index ] + 2 );
+
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] ]     = 'A';
+			byte_stream[ byte_stream_offset + terminator_offsets[ test_index ] + 1 ] = 'A';
+		}
+		/* Test a pair of 0-byte values at an odd offset within and across the boundary of
+		 * the blocks that are scanned at once, which is not a terminator
+		 */
+		for( test_index = 0;
+		     test_index < 2;
+		     test_index++ )
+		{
+			byte_stream[ byte_stream_offset + unaligned_offsets[ test_index ] ]     = 0;
+			byte_stream[ byte_stream_offset + unaligned_offsets[ test_index ] + 1 ] = 0;
+
+			string_size = libfwsi_string_get_utf16_stream_string_size(
+			               byte_stream,
+			               40,
+			               byte_stream_offset );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "string_size",
+			 string_size,
+			 ( ( 40 - byte_stream_offset ) & ~( (size_t) 1 ) ) );
+
+			byte_stream[ byte_stream_offset + 20 ] = 0;
+			byte_stream[ byte_stream_offset + 21 ] = 0;
+
+			string_size = libfwsi_string_get_utf16_stream_string_size(
+			               byte_stream,
+			               40,
+			               byte_stream_offset );
+
+			FWSI_TEST_ASSERT_EQUAL_SIZE(
+			 "string_size",
+			 string_size,
+			 (size_t) 22 );
+
+			byte_stream[ byte_stream_offset + unaligned_offsets[ test_index ] ]     = 'A';
+			byte_stream[ byte_stream_offset + unaligned_offsets[ test_index ] + 1 ] = 'A';
+			byte_stream[ byte_stream_offset + 20 ]                                  = 'A';
+			byte_stream[ byte_stream_offset + 21 ]                                  = 'A';
+		}
+		/* Test a string without a terminator that ends at the end of the byte stream,
+		 * a trailing odd byte is not part of the string
+		 */
+		string_size = libfwsi_string_get_utf16_stream_string_size(
+		               byte_stream,
+		               40,
+		               byte_stream_offset );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_size",
+		 string_size,
+		 ( ( 40 - byte_stream_offset ) & ~( (size_t) 1 ) ) );
+	}
+	/* Test error cases
+	 */
+	string_size = libfwsi_string_get_utf16_stream_string_size(
+	               byte_stream,
+	               40,
+	               40 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	string_size = libfwsi_string_get_utf16_stream_string_size(
+	               NULL,
+	               40,
+	               0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_scan_7bit_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_scan_7bit_ascii(
+     void )
+{
+	size_t string_sizes[ 5 ] = {
+		0,
+		1,
+		15,
+		16,
+		17 };
+
+	size_t string_offsets[ 6 ] = {
+		0,
+		7,
+		8,
+		15,
+		16,
+		32 };
+
+	uint8_t string[ 33 ];
+
+	size_t string_index = 0;
+	int test_index      = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     string,
+	     'A',
+	     33 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 5;
+	     test_index++ )
+	{
+		string_index = libfwsi_string_scan_7bit_ascii(
+		                string,
+		                string_sizes[ test_index ] );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 string_sizes[ test_index ] );
+	}
+	/* Test a byte that is not 7-bit ASCII within and at the boundaries of the blocks
+	 * that are scanned at once and in the last byte
+	 */
+	for( test_index = 0;
+	     test_index < 6;
+	     test_index++ )
+	{
+		string[ string_offsets[ test_index ] ] = 0x80;
+
+		string_index = libfwsi_string_scan_7bit_ascii(
+		                string,
+		                33 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 string_offsets[ test_index ] );
+
+		string[ string_offsets[ test_index ] ] = 0xff;
+
+		string_index = libfwsi_string_scan_7bit_ascii(
+		                string,
+		                33 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 string_offsets[ test_index ] );
+
+		string[ string_offsets[ test_index ] ] = 0;
+
+		string_index = libfwsi_string_scan_7bit_ascii(
+		                string,
+		                33 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "string_index",
+		 string_index,
+		 string_offsets[ test_index ] );
+
+		string[ string_offsets[ test_index ] ] = 'A';
+	}
+	/* Test a byte that is not 7-bit ASCII in the last byte of a string of 17 bytes
+	 */
+	string[ 16 ] = 0xe9;
+
+	string_index = libfwsi_string_scan_7bit_ascii(
+	                string,
+	                17 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 16 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_get_utf8_size_from_byte_stream and libfwsi_string_copy_utf8_from_byte_stream functions
+ * The 7-bit ASCII strings are copied directly and the other strings are converted by libuna,
+ * both are compared with the output of libuna
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_copy_utf8_from_byte_stream(
+     void )
+{
+	size_t string_lengths[ 5 ] = {
+		0,
+		1,
+		15,
+		16,
+		17 };
+
+	size_t string_offsets[ 6 ] = {
+		0,
+		7,
+		8,
+		15,
+		16,
+		32 };
+
+	uint8_t byte_stream[ 34 ];
+	uint8_t expected_utf8_string[ 64 ];
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t byte_stream_size          = 0;
+	size_t expected_utf8_string_size = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     byte_stream,
+	     'A',
+	     34 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test 7-bit ASCII strings with the end of string character in the first iterations,
+	 * without the end of string character in the next iterations and strings of 33 bytes
+	 * with a Windows 1252 character at the string offsets in the last iterations
+	 */
+	for( test_index = 0;
+	     test_index < 16;
+	     test_index++ )
+	{
+		if( test_index < 5 )
+		{
+			byte_stream[ string_lengths[ test_index ] ] = 0;
+
+			byte_stream_size = string_lengths[ test_index ] + 1;
+		}
+		else if( test_index < 10 )
+		{
+			byte_stream_size = string_lengths[ test_index - 5 ];
+		}
+		else
+		{
+			byte_stream[ string_offsets[ test_index - 10 ] ] = 0xe9;
+			byte_stream[ 33 ]                                 = 0;
+
+			byte_stream_size = 34;
+		}
+		result = libuna_utf8_string_size_from_byte_stream(
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &expected_utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libuna_utf8_string_copy_from_byte_stream(
+		          expected_utf8_string,
+		          64,
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_string_get_utf8_size_from_byte_stream(
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 expected_utf8_string_size );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_string_copy_utf8_from_byte_stream(
+		          utf8_string,
+		          64,
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          expected_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test a UTF-8 string that is 1 byte too small
+		 */
+		result = libfwsi_string_copy_utf8_from_byte_stream(
+		          utf8_string,
+		          expected_utf8_string_size - 1,
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		if( test_index < 5 )
+		{
+			byte_stream[ string_lengths[ test_index ] ] = 'A';
+		}
+		else if( test_index >= 10 )
+		{
+			byte_stream[ string_offsets[ test_index - 10 ] ] = 'A';
+		}
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_string_copy_utf8_from_byte_stream(
+	          NULL,
+	          64,
+	          byte_stream,
+	          34,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          64,
+	          NULL,
+	          34,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_with_index_copy_utf8_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_with_index_copy_utf8_from_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 4 ] = {
+		'C', 'a', 'f', 0xe9 };
+
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test a 7-bit ASCII string that is copied directly
+	 */
+	result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          fwsi_test_string_byte_stream1,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 10 );
+
+	/* Test a string that is converted by libuna and that overwrites
+	 * the end of string character of the previous string
+	 */
+	utf8_string_index -= 1;
+
+	result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          byte_stream,
+	          4,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 15 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "DirectoryCaf\xc3\xa9",
+	          15 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 12;
+
+	result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          fwsi_test_string_byte_stream1,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 12 );
+
+	utf8_string_index = 16;
+
+	result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          fwsi_test_string_byte_stream1,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_with_index_copy_utf8_from_byte_stream(
+	          utf8_string,
+	          16,
+	          NULL,
+	          fwsi_test_string_byte_stream1,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_convert_utf16_stream_to_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_convert_utf16_stream_to_utf8(
+     void )
+{
+	uint8_t *utf16_streams[ 11 ] = {
+		fwsi_test_string_utf16_stream2,
+		fwsi_test_string_utf16_stream3,
+		fwsi_test_string_utf16_stream4,
+		fwsi_test_string_utf16_stream5,
+		fwsi_test_string_utf16_stream6,
+		fwsi_test_string_utf16_stream7,
+		fwsi_test_string_utf16_stream8,
+		fwsi_test_string_utf16_stream9,
+		fwsi_test_string_utf16_stream10,
+		fwsi_test_string_utf16_stream11,
+		fwsi_test_string_utf16_stream12 };
+
+	size_t utf16_stream_sizes[ 11 ] = {
+		16,
+		18,
+		32,
+		34,
+		36,
+		36,
+		10,
+		10,
+		12,
+		20,
+		18 };
+
+	uint8_t expected_utf8_string[ 64 ];
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t expected_utf8_string_size = 0;
+	size_t required_utf8_string_size = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	/* Test regular cases, the output is compared with that of libuna
+	 */
+	for( test_index = 0;
+	     test_index < 11;
+	     test_index++ )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          &expected_utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libuna_utf8_string_copy_from_utf16_stream(
+		          expected_utf8_string,
+		          64,
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test determining only the required UTF-8 string size
+		 */
+		result = libfwsi_string_convert_utf16_stream_to_utf8(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          NULL,
+		          0,
+		          &required_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		if( memory_set(
+		     utf8_string,
+		     0xff,
+		     64 ) == NULL )
+		{
+			goto on_error;
+		}
+		result = libfwsi_string_convert_utf16_stream_to_utf8(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          utf8_string,
+		          64,
+		          &required_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          expected_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test a UTF-8 string that is 1 byte too small, which must not be written past its end
+		 */
+		if( memory_set(
+		     utf8_string,
+		     0xff,
+		     64 ) == NULL )
+		{
+			goto on_error;
+		}
+		result = libfwsi_string_convert_utf16_stream_to_utf8(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          utf8_string,
+		          expected_utf8_string_size - 1,
+		          &required_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "utf8_string[ expected_utf8_string_size - 1 ]",
+		 (int) utf8_string[ expected_utf8_string_size - 1 ],
+		 0xff );
+
+		result = libfwsi_string_copy_utf8_from_utf16_stream(
+		          utf8_string,
+		          expected_utf8_string_size - 1,
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "utf8_string[ expected_utf8_string_size - 1 ]",
+		 (int) utf8_string[ expected_utf8_string_size - 1 ],
+		 0xff );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_string_convert_utf16_stream_to_utf8(
+	          NULL,
+	          16,
+	          utf8_string,
+	          64,
+	          &required_utf8_string_size );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwsi_string_convert_utf16_stream_to_utf8(
+	          fwsi_test_string_utf16_stream2,
+	          16,
+	          utf8_string,
+	          64,
+	          NULL );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_convert_utf16_stream_to_utf8 function with streams that are left to libuna
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_convert_utf16_stream_to_utf8_unconverted(
+     void )
+{
+	uint8_t *utf16_streams[ 5 ] = {
+		fwsi_test_string_utf16_stream13,
+		fwsi_test_string_utf16_stream14,
+		fwsi_test_string_utf16_stream15,
+		fwsi_test_string_utf16_stream16,
+		fwsi_test_string_utf16_stream17 };
+
+	size_t utf16_stream_sizes[ 5 ] = {
+		4,
+		8,
+		8,
+		8,
+		7 };
+
+	uint8_t expected_utf8_string[ 64 ];
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t expected_utf8_string_size = 0;
+	size_t required_utf8_string_size = 0;
+	size_t utf8_string_size          = 0;
+	int expected_result              = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	for( test_index = 0;
+	     test_index < 5;
+	     test_index++ )
+	{
+		/* Test that the stream is not converted
+		 */
+		result = libfwsi_string_convert_utf16_stream_to_utf8(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          utf8_string,
+		          64,
+		          &required_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test that the conversion falls back to libuna
+		 */
+		expected_result = libuna_utf8_string_size_from_utf16_stream(
+		                   utf16_streams[ test_index ],
+		                   utf16_stream_sizes[ test_index ],
+		                   LIBUNA_ENDIAN_LITTLE,
+		                   &expected_utf8_string_size,
+		                   &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfwsi_string_get_utf8_size_from_utf16_stream(
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          &utf8_string_size,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_result );
+
+		libcerror_error_free(
+		 &error );
+
+		if( expected_result != 1 )
+		{
+			continue;
+		}
+		FWSI_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 expected_utf8_string_size );
+
+		result = libuna_utf8_string_copy_from_utf16_stream(
+		          expected_utf8_string,
+		          64,
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwsi_string_copy_utf8_from_utf16_stream(
+		          utf8_string,
+		          64,
+		          utf16_streams[ test_index ],
+		          utf16_stream_sizes[ test_index ],
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          expected_utf8_string_size );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_get_byte_stream_string_size",
+	 fwsi_test_string_get_byte_stream_string_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_get_utf16_stream_string_size",
+	 fwsi_test_string_get_utf16_stream_string_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_scan_7bit_ascii",
+	 fwsi_test_string_scan_7bit_ascii );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_copy_utf8_from_byte_stream",
+	 fwsi_test_string_copy_utf8_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_with_index_copy_utf8_from_byte_stream",
+	 fwsi_test_string_with_index_copy_utf8_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_convert_utf16_stream_to_utf8",
+	 fwsi_test_string_convert_utf16_stream_to_utf8 );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_convert_utf16_stream_to_utf8",
+	 fwsi_test_string_convert_utf16_stream_to_utf8_unconverted );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_cache_free",
+	 fwsi_test_string_cache_free );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_cache_get_utf8_string",
+	 fwsi_test_string_cache_get_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
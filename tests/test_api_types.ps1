@@ -10,7 +10,7 @@ $TestPrefix = Split-Path -path ${Pwd}.Path -parent
 $TestPrefix = Split-Path -path ${TestPrefix} -leaf
 $TestPrefix = ${TestPrefix}.Substring(3)
 
-$TestTypes = "extension_block item item_list"
+$TestTypes = "batch extension_block file_entry file_entry_extension item item_list network_location scanner stream_parser string volume"
 $TestTypes = ${TestTypes} -split " "
 
 $TestToolDirectory = "..\msvscpp\Release"
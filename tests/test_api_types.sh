@@ -11,7 +11,7 @@ TEST_PREFIX=`dirname ${PWD}`;
 TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
 
 TEST_PROFILE="lib${TEST_PREFIX}";
-TEST_TYPES="extension_block item item_list";
+TEST_TYPES="batch extension_block file_entry file_entry_extension item item_list network_location scanner stream_parser string volume";
 TEST_TYPES_WITH_INPUT="";
 OPTION_SETS="";
 